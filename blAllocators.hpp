@@ -0,0 +1,719 @@
+#ifndef BL_ALLOCATORS_HPP
+#define BL_ALLOCATORS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blAllocators.hpp
+// CLASS:           blArena
+//                  blPool
+//                  blArenaAllocator
+//                  blPoolAllocator
+//                  blThreadLocalArenaAllocator
+// BASE CLASS:      None
+//
+// PURPOSE:         Memory resources and c++ allocators used to
+//                  cut the cost of creating and destroying
+//                  many short lived containers.
+//
+//                  - blArena -- A monotonic "bump" allocator.
+//                               Memory is carved out of big
+//                               blocks and is only given back
+//                               all at once by calling "reset"
+//                               or "release".
+//
+//                  - blPool -- A fixed-size chunk allocator
+//                              that recycles freed chunks
+//                              through a free-list.
+//
+//                  - blArenaAllocator,
+//                    blPoolAllocator,
+//                    blThreadLocalArenaAllocator -- Standard
+//                    c++ allocators built on top of the
+//                    resources above, so they can be handed
+//                    to any owning container in this library
+//                    or to std::allocate_shared.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - ::operator new/delete -- Used to get the
+//                                             big blocks of
+//                                             memory
+//
+// NOTES:           - blArena and blPool are NOT thread safe,
+//                    each thread should use its own resource,
+//                    for example the one returned by the
+//                    function "getThreadLocalArena"
+//
+//                  - Memory handed out by an arena is never
+//                    given back individually, so an arena
+//                    allocator's "deallocate" does nothing
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The default size in bytes of
+// the blocks requested by the
+// arena and the pool
+//-------------------------------------------------------------------
+const size_t                                                blDefaultArenaBlockSize = 64 * 1024;
+const size_t                                                blDefaultPoolChunksPerBlock = 256;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Monotonic "bump" allocator
+//-------------------------------------------------------------------
+class blArena
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blArena(const size_t& blockSize = blDefaultArenaBlockSize);
+
+    // An arena owns its
+    // memory, so it cannot
+    // be copied
+
+    blArena(const blArena& arena) = delete;
+
+    // Destructor
+
+    ~blArena()
+    {
+        release();
+    }
+
+public: // Assignment operators
+
+    blArena&                                                operator=(const blArena& arena) = delete;
+
+public: // Public functions
+
+    // Function used to
+    // allocate memory
+    // from the arena (the
+    // alignment has to be
+    // a power of two)
+
+    void*                                                   allocate(const size_t& numberOfBytes,
+                                                                     const size_t& alignment = alignof(std::max_align_t));
+
+    // Memory is only given
+    // back all at once, so
+    // this function does
+    // nothing
+
+    void                                                    deallocate(void*,
+                                                                       const size_t&)
+    {
+    }
+
+    // Function used to
+    // rewind the arena
+    // keeping its biggest
+    // block around to be
+    // reused
+
+    void                                                    reset();
+
+    // Function used to
+    // give all the memory
+    // back to the system
+
+    void                                                    release();
+
+    // Functions used to
+    // query the arena
+
+    size_t                                                  getBlockSize()const{return m_blockSize;}
+    size_t                                                  getBytesAllocated()const{return m_bytesAllocated;}
+    size_t                                                  getBytesReserved()const{return m_bytesReserved;}
+
+private: // Private functions
+
+    // Function used to
+    // get a new block big
+    // enough to hold the
+    // specified bytes
+
+    void                                                    addBlock(const size_t& minimumNumberOfBytes);
+
+private: // Private variables
+
+    // Each block starts
+    // with this header and
+    // the blocks are linked
+    // together so they can
+    // be released later
+
+    struct blArenaBlock
+    {
+        blArenaBlock*                                       m_next;
+        size_t                                              m_size;
+    };
+
+    // The list of blocks,
+    // the most recent one
+    // being first
+
+    blArenaBlock*                                           m_blocks;
+
+    // The part of the
+    // current block still
+    // available
+
+    char*                                                   m_current;
+    char*                                                   m_end;
+
+    // Block size and
+    // some statistics
+
+    size_t                                                  m_blockSize;
+    size_t                                                  m_bytesAllocated;
+    size_t                                                  m_bytesReserved;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blArena::blArena(const size_t& blockSize)
+{
+    m_blocks = nullptr;
+    m_current = nullptr;
+    m_end = nullptr;
+    m_blockSize = blockSize;
+    m_bytesAllocated = 0;
+    m_bytesReserved = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void* blArena::allocate(const size_t& numberOfBytes,
+                               const size_t& alignment)
+{
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+
+    // Sizes so big that adding
+    // the alignment to them wraps
+    // around can't be allocated
+
+    if(numberOfBytes > std::numeric_limits<size_t>::max() - alignment)
+        throw std::bad_alloc();
+
+    // Align the current
+    // position
+
+    size_t misalignment = reinterpret_cast<uintptr_t>(m_current) & (alignment - 1);
+    size_t padding = misalignment ? alignment - misalignment : 0;
+
+    if(m_current == nullptr ||
+       static_cast<size_t>(m_end - m_current) < padding + numberOfBytes)
+    {
+        addBlock(numberOfBytes + alignment);
+
+        misalignment = reinterpret_cast<uintptr_t>(m_current) & (alignment - 1);
+        padding = misalignment ? alignment - misalignment : 0;
+    }
+
+    void* ptr = m_current + padding;
+
+    m_current += padding + numberOfBytes;
+    m_bytesAllocated += numberOfBytes;
+
+    return ptr;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blArena::addBlock(const size_t& minimumNumberOfBytes)
+{
+    size_t blockSize = m_blockSize;
+
+    if(blockSize < minimumNumberOfBytes)
+        blockSize = minimumNumberOfBytes;
+
+    // The header is padded so
+    // the data that follows it
+    // is maximally aligned
+
+    const size_t headerSize = ( (sizeof(blArenaBlock) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) ) * alignof(std::max_align_t);
+
+    if(blockSize > std::numeric_limits<size_t>::max() - headerSize)
+        throw std::bad_alloc();
+
+    blArenaBlock* block = static_cast<blArenaBlock*>(::operator new(headerSize + blockSize));
+
+    block->m_next = m_blocks;
+    block->m_size = blockSize;
+
+    m_blocks = block;
+    m_current = reinterpret_cast<char*>(block) + headerSize;
+    m_end = m_current + blockSize;
+    m_bytesReserved += blockSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blArena::reset()
+{
+    if(m_blocks == nullptr)
+        return;
+
+    // Find the biggest
+    // block and free all
+    // the others
+
+    blArenaBlock* biggestBlock = m_blocks;
+
+    for(blArenaBlock* block = m_blocks; block != nullptr; block = block->m_next)
+    {
+        if(block->m_size > biggestBlock->m_size)
+            biggestBlock = block;
+    }
+
+    blArenaBlock* block = m_blocks;
+
+    while(block != nullptr)
+    {
+        blArenaBlock* nextBlock = block->m_next;
+
+        if(block != biggestBlock)
+            ::operator delete(block);
+
+        block = nextBlock;
+    }
+
+    const size_t headerSize = ( (sizeof(blArenaBlock) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) ) * alignof(std::max_align_t);
+
+    biggestBlock->m_next = nullptr;
+
+    m_blocks = biggestBlock;
+    m_current = reinterpret_cast<char*>(biggestBlock) + headerSize;
+    m_end = m_current + biggestBlock->m_size;
+    m_bytesAllocated = 0;
+    m_bytesReserved = biggestBlock->m_size;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blArena::release()
+{
+    blArenaBlock* block = m_blocks;
+
+    while(block != nullptr)
+    {
+        blArenaBlock* nextBlock = block->m_next;
+        ::operator delete(block);
+        block = nextBlock;
+    }
+
+    m_blocks = nullptr;
+    m_current = nullptr;
+    m_end = nullptr;
+    m_bytesAllocated = 0;
+    m_bytesReserved = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Fixed-size chunk allocator
+//-------------------------------------------------------------------
+class blPool
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blPool(const size_t& chunkSize,
+           const size_t& chunksPerBlock = blDefaultPoolChunksPerBlock);
+
+    // A pool owns its
+    // memory, so it cannot
+    // be copied
+
+    blPool(const blPool& pool) = delete;
+
+    // Destructor
+
+    ~blPool()
+    {
+        release();
+    }
+
+public: // Assignment operators
+
+    blPool&                                                 operator=(const blPool& pool) = delete;
+
+public: // Public functions
+
+    // Functions used to
+    // get and give back
+    // one chunk
+
+    void*                                                   allocate();
+    void                                                    deallocate(void* ptr);
+
+    // Function used to
+    // give all the memory
+    // back to the system
+    //
+    // NOTE:    All chunks handed
+    //          out become invalid
+
+    void                                                    release();
+
+    // Functions used to
+    // query the pool
+
+    size_t                                                  getChunkSize()const{return m_chunkSize;}
+    size_t                                                  getChunksPerBlock()const{return m_chunksPerBlock;}
+
+private: // Private functions
+
+    void                                                    addBlock();
+
+private: // Private variables
+
+    // Free chunks are
+    // linked through their
+    // own storage
+
+    struct blFreeChunk
+    {
+        blFreeChunk*                                        m_next;
+    };
+
+    // The list of free
+    // chunks and the list
+    // of blocks owned by
+    // the pool
+
+    blFreeChunk*                                            m_freeChunks;
+    blFreeChunk*                                            m_blocks;
+
+    // The chunk size (rounded
+    // up so every chunk is
+    // maximally aligned) and
+    // how many chunks are
+    // carved out of each block
+
+    size_t                                                  m_chunkSize;
+    size_t                                                  m_chunksPerBlock;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline blPool::blPool(const size_t& chunkSize,
+                      const size_t& chunksPerBlock)
+{
+    m_freeChunks = nullptr;
+    m_blocks = nullptr;
+
+    size_t roundedChunkSize = (chunkSize < sizeof(blFreeChunk) ? sizeof(blFreeChunk) : chunkSize);
+
+    m_chunkSize = ( (roundedChunkSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) ) * alignof(std::max_align_t);
+    m_chunksPerBlock = (chunksPerBlock > 0 ? chunksPerBlock : 1);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void* blPool::allocate()
+{
+    if(m_freeChunks == nullptr)
+        addBlock();
+
+    blFreeChunk* chunk = m_freeChunks;
+    m_freeChunks = chunk->m_next;
+
+    return chunk;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blPool::deallocate(void* ptr)
+{
+    if(ptr == nullptr)
+        return;
+
+    blFreeChunk* chunk = static_cast<blFreeChunk*>(ptr);
+
+    chunk->m_next = m_freeChunks;
+    m_freeChunks = chunk;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blPool::addBlock()
+{
+    // The first chunk of
+    // every block is used
+    // to link the blocks
+    // together
+
+    char* block = static_cast<char*>(::operator new(m_chunkSize * (m_chunksPerBlock + 1)));
+
+    reinterpret_cast<blFreeChunk*>(block)->m_next = m_blocks;
+    m_blocks = reinterpret_cast<blFreeChunk*>(block);
+
+    for(size_t i = m_chunksPerBlock; i > 0; --i)
+    {
+        blFreeChunk* chunk = reinterpret_cast<blFreeChunk*>(block + i * m_chunkSize);
+
+        chunk->m_next = m_freeChunks;
+        m_freeChunks = chunk;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline void blPool::release()
+{
+    blFreeChunk* block = m_blocks;
+
+    while(block != nullptr)
+    {
+        blFreeChunk* nextBlock = block->m_next;
+        ::operator delete(block);
+        block = nextBlock;
+    }
+
+    m_blocks = nullptr;
+    m_freeChunks = nullptr;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get the
+// calling thread's own arena
+//-------------------------------------------------------------------
+inline blArena& getThreadLocalArena()
+{
+    static thread_local blArena threadLocalArena;
+
+    return threadLocalArena;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Standard c++ allocator getting
+// its memory from a blArena
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blArenaAllocator
+{
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    template<typename blDataType2>
+    struct rebind
+    {
+        typedef blArenaAllocator<blDataType2>               other;
+    };
+
+public: // Constructors and destructors
+
+    blArenaAllocator(blArena& arena) : m_arena(&arena){}
+
+    template<typename blDataType2>
+    blArenaAllocator(const blArenaAllocator<blDataType2>& allocator) : m_arena(allocator.getArena()){}
+
+public: // Public functions
+
+    blDataType*                                             allocate(const size_t& n)
+    {
+        return static_cast<blDataType*>(m_arena->allocate(n * sizeof(blDataType),alignof(blDataType)));
+    }
+
+    void                                                    deallocate(blDataType*,const size_t&)
+    {
+    }
+
+    blArena*                                                getArena()const{return m_arena;}
+
+private: // Private variables
+
+    blArena*                                                m_arena;
+};
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator==(const blArenaAllocator<blDataType1>& allocator1,const blArenaAllocator<blDataType2>& allocator2)
+{
+    return (allocator1.getArena() == allocator2.getArena());
+}
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator!=(const blArenaAllocator<blDataType1>& allocator1,const blArenaAllocator<blDataType2>& allocator2)
+{
+    return (allocator1.getArena() != allocator2.getArena());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Standard c++ allocator getting its
+// memory from a blPool
+//
+// NOTE:    Requests that do not fit in
+//          one chunk of the pool (for
+//          example a node allocator
+//          rebound to a bigger type or
+//          a vector asking for many
+//          elements) fall back to
+//          ::operator new, so one pool
+//          can safely be shared with
+//          std::allocate_shared whose
+//          control block size is only
+//          known to the standard library
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blPoolAllocator
+{
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    template<typename blDataType2>
+    struct rebind
+    {
+        typedef blPoolAllocator<blDataType2>                other;
+    };
+
+public: // Constructors and destructors
+
+    blPoolAllocator(blPool& pool) : m_pool(&pool){}
+
+    template<typename blDataType2>
+    blPoolAllocator(const blPoolAllocator<blDataType2>& allocator) : m_pool(allocator.getPool()){}
+
+public: // Public functions
+
+    blDataType*                                             allocate(const size_t& n)
+    {
+        if(fitsInChunk(n))
+            return static_cast<blDataType*>(m_pool->allocate());
+        else
+            return static_cast<blDataType*>(::operator new(n * sizeof(blDataType)));
+    }
+
+    void                                                    deallocate(blDataType* ptr,const size_t& n)
+    {
+        if(fitsInChunk(n))
+            m_pool->deallocate(ptr);
+        else
+            ::operator delete(ptr);
+    }
+
+    blPool*                                                 getPool()const{return m_pool;}
+
+private: // Private functions
+
+    bool                                                    fitsInChunk(const size_t& n)const
+    {
+        return ( n * sizeof(blDataType) <= m_pool->getChunkSize() &&
+                 alignof(blDataType) <= alignof(std::max_align_t) );
+    }
+
+private: // Private variables
+
+    blPool*                                                 m_pool;
+};
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator==(const blPoolAllocator<blDataType1>& allocator1,const blPoolAllocator<blDataType2>& allocator2)
+{
+    return (allocator1.getPool() == allocator2.getPool());
+}
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator!=(const blPoolAllocator<blDataType1>& allocator1,const blPoolAllocator<blDataType2>& allocator2)
+{
+    return (allocator1.getPool() != allocator2.getPool());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Stateless standard c++ allocator
+// getting its memory from the calling
+// thread's own arena
+//
+// NOTE:    The memory lives until the
+//          owning thread calls "reset"
+//          or "release" on its arena
+//          (or exits), so containers
+//          using this allocator should
+//          not outlive that point
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blThreadLocalArenaAllocator
+{
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    template<typename blDataType2>
+    struct rebind
+    {
+        typedef blThreadLocalArenaAllocator<blDataType2>    other;
+    };
+
+public: // Constructors and destructors
+
+    blThreadLocalArenaAllocator() = default;
+
+    template<typename blDataType2>
+    blThreadLocalArenaAllocator(const blThreadLocalArenaAllocator<blDataType2>&){}
+
+public: // Public functions
+
+    blDataType*                                             allocate(const size_t& n)
+    {
+        return static_cast<blDataType*>(getThreadLocalArena().allocate(n * sizeof(blDataType),alignof(blDataType)));
+    }
+
+    void                                                    deallocate(blDataType*,const size_t&)
+    {
+    }
+};
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator==(const blThreadLocalArenaAllocator<blDataType1>&,const blThreadLocalArenaAllocator<blDataType2>&)
+{
+    return true;
+}
+
+template<typename blDataType1,typename blDataType2>
+inline bool operator!=(const blThreadLocalArenaAllocator<blDataType1>&,const blThreadLocalArenaAllocator<blDataType2>&)
+{
+    return false;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_ALLOCATORS_HPP
@@ -0,0 +1,440 @@
+#ifndef BL_ANYITERATOR_HPP
+#define BL_ANYITERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blAnyIterator.hpp
+// CLASS:           blAnyIteratorVTable
+//                  blAnyIteratorVTableOf
+//                  blAnyIterator
+// BASE CLASS:      None
+//
+// PURPOSE:         A type erased iterator, used to pass any blIterator
+//                  (blLinearIterator, blCircularIterator, ...) through
+//                  boundaries (plugins and such) that can't see the
+//                  blIterator<Container,Advance,BeginEnd> template,
+//                  knowing only the type of the data it points to.
+//
+//                  - The erased iterator is stored inline in a small
+//                    buffer, so nothing is ever allocated
+//
+//                  - Every operation goes through a single pointer
+//                    to a static table of functions, one table per
+//                    erased iterator type
+//
+//                  - next_n (or take_batch) fetches a whole contiguous
+//                    segment with a single indirect call, so the
+//                    cost of the indirection is paid per segment
+//                    instead of per element
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blIterator
+//                  - blRawArrayWrapper -- The segments
+//
+// NOTES:           - Only blIterators can be erased, raw pointers
+//                    and std iterators fail to compile (their
+//                    containers can be wrapped in a blIterator)
+//
+//                  - An iterator too big (or too aligned) for the
+//                    buffer fails to compile, the buffer size is
+//                    the second template parameter
+//
+//                  - Iterators over non contiguous containers
+//                    (lists, reversed ranges, channel views, ...)
+//                    fetch segments of one element
+//
+//                  - Comparing (or subtracting) blAnyIterators
+//                    only makes sense when they erase the same
+//                    iterator type over the same container
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Default size of the buffer holding
+// the erased iterator, big enough for
+// every blIterator alias over the
+// library's and std containers
+//-------------------------------------------------------------------
+const size_t                                                blAnyIteratorBufferSize = 64;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Trait used to know whether a
+// type is (or derives from) a
+// blIterator, the only iterators
+// blAnyIterator erases
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+std::true_type blIsBlIteratorTest(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>*);
+
+std::false_type blIsBlIteratorTest(...);
+
+template<typename blIteratorType>
+struct blIsBlIterator : decltype(blIsBlIteratorTest(std::declval<blIteratorType*>()))
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The table of functions used
+// to operate the erased iterator
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blAnyIteratorVTable
+{
+    void                                                    (*copy)(void* destination,const void* source);
+    void                                                    (*move)(void* destination,void* source);
+    void                                                    (*destroy)(void* iterator);
+
+    blDataType&                                             (*dereference)(const void* iterator);
+    void                                                    (*advance)(void* iterator,const ptrdiff_t& offset);
+
+    bool                                                    (*equal)(const void* iterator1,const void* iterator2);
+    ptrdiff_t                                               (*distance)(const void* first,const void* last);
+    bool                                                    (*isValid)(const void* iterator);
+
+    blRawArrayWrapper<blDataType>                           (*next_n)(void* iterator,const size_t& n);
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to fetch the next
+// segment of up to "n" elements
+// from a blIterator
+//-------------------------------------------------------------------
+// Contiguous containers
+// use the iterator's own
+// batches
+
+template<typename blDataType,typename blIteratorType>
+inline blRawArrayWrapper<blDataType> blAnyIteratorNextN(blIteratorType& iterator,
+                                                        const size_t& n,
+                                                        std::true_type)
+{
+    auto batch = iterator.next_n(n);
+
+    return blRawArrayWrapper<blDataType>(batch.begin().getPtr(),batch.size());
+}
+
+// Other containers get
+// segments of one element
+
+template<typename blDataType,typename blIteratorType>
+inline blRawArrayWrapper<blDataType> blAnyIteratorNextN(blIteratorType& iterator,
+                                                        const size_t& n,
+                                                        std::false_type)
+{
+    if(n == 0 || !iterator || iterator.getDistanceFromIterToEnd() <= 0)
+        return blRawArrayWrapper<blDataType>();
+
+    blRawArrayWrapper<blDataType> segment(&(*iterator),1);
+
+    ++iterator;
+
+    return segment;
+}
+
+// blIterators are told
+// apart by whether their
+// container is contiguous
+// (or segmented)
+
+template<typename blDataType,typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline blRawArrayWrapper<blDataType> blAnyIteratorNextN(blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& iterator,
+                                                        const size_t& n)
+{
+    typedef blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>   blIteratorType;
+
+    return blAnyIteratorNextN<blDataType>(iterator,
+                                          n,
+                                          std::integral_constant<bool,blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value ||
+                                                                      blIsSegmentedIterator<typename blIteratorType::iterator>::value>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The table of functions of
+// a specific iterator type
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIteratorType>
+struct blAnyIteratorVTableOf
+{
+    static const blAnyIteratorVTable<blDataType>            vtable;
+
+    static const blIteratorType&                            get(const void* iterator){return (*static_cast<const blIteratorType*>(iterator));}
+    static blIteratorType&                                  get(void* iterator){return (*static_cast<blIteratorType*>(iterator));}
+
+    static void                                             copy(void* destination,const void* source){new (destination) blIteratorType(get(source));}
+    static void                                             move(void* destination,void* source){new (destination) blIteratorType(std::move(get(source)));}
+    static void                                             destroy(void* iterator){get(iterator).~blIteratorType();}
+
+    static blDataType&                                      dereference(const void* iterator){return (*get(iterator));}
+    static void                                             advance(void* iterator,const ptrdiff_t& offset){get(iterator) += offset;}
+
+    static bool                                             equal(const void* iterator1,const void* iterator2){return (get(iterator1) == get(iterator2));}
+    static ptrdiff_t                                        distance(const void* first,const void* last){return (get(last) - get(first));}
+    static bool                                             isValid(const void* iterator){return static_cast<bool>(get(iterator));}
+
+    static blRawArrayWrapper<blDataType>                    next_n(void* iterator,const size_t& n){return blAnyIteratorNextN<blDataType>(get(iterator),n);}
+};
+
+template<typename blDataType,typename blIteratorType>
+const blAnyIteratorVTable<blDataType> blAnyIteratorVTableOf<blDataType,blIteratorType>::vtable =
+{
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::copy,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::move,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::destroy,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::dereference,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::advance,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::equal,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::distance,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::isValid,
+    &blAnyIteratorVTableOf<blDataType,blIteratorType>::next_n
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The type erased iterator
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBufferSize = blAnyIteratorBufferSize>
+
+class blAnyIterator : public std::iterator<std::random_access_iterator_tag,
+                                           typename std::remove_const<blDataType>::type,
+                                           ptrdiff_t,
+                                           blDataType*,
+                                           blDataType&>
+{
+public: // Public typedefs
+
+    typedef blRawArrayWrapper<blDataType>                   blBatchType;
+
+public: // Constructors and destructors
+
+    // Default constructor,
+    // holding no iterator
+
+    blAnyIterator() : m_vtable(nullptr)
+    {
+    }
+
+    // Constructor erasing
+    // an iterator
+
+    template<typename blIteratorType,
+             typename = typename std::enable_if<!std::is_base_of<blAnyIterator<blDataType,blBufferSize>,
+                                                                 typename std::decay<blIteratorType>::type>::value>::type>
+    blAnyIterator(blIteratorType&& iterator)
+    {
+        typedef typename std::decay<blIteratorType>::type   blErasedIteratorType;
+
+        static_assert(blIsBlIterator<blErasedIteratorType>::value,
+                      "blAnyIterator only erases blIterators (blLinearIterator, blCircularIterator, ...), wrap raw pointers and std iterators' containers in one");
+
+        static_assert(sizeof(blErasedIteratorType) <= blBufferSize,
+                      "The iterator doesn't fit in the blAnyIterator's buffer");
+
+        static_assert(alignof(blErasedIteratorType) <= alignof(std::max_align_t),
+                      "The iterator is too aligned for the blAnyIterator's buffer");
+
+        static_assert(std::is_convertible<typename std::remove_reference<decltype(*iterator)>::type*,blDataType*>::value &&
+                      std::is_lvalue_reference<decltype(*iterator)>::value,
+                      "The iterator has to dereference into a reference to the blAnyIterator's data type");
+
+        new (m_buffer) blErasedIteratorType(std::forward<blIteratorType>(iterator));
+
+        m_vtable = &blAnyIteratorVTableOf<blDataType,blErasedIteratorType>::vtable;
+    }
+
+    // Copy and move
+    // constructors
+
+    blAnyIterator(const blAnyIterator<blDataType,blBufferSize>& iterator) : m_vtable(iterator.m_vtable)
+    {
+        if(m_vtable)
+            m_vtable->copy(m_buffer,iterator.m_buffer);
+    }
+
+    blAnyIterator(blAnyIterator<blDataType,blBufferSize>&& iterator) : m_vtable(iterator.m_vtable)
+    {
+        if(m_vtable)
+            m_vtable->move(m_buffer,iterator.m_buffer);
+    }
+
+    // Destructor
+
+    ~blAnyIterator()
+    {
+        if(m_vtable)
+            m_vtable->destroy(m_buffer);
+    }
+
+public: // Assignment operators
+
+    blAnyIterator<blDataType,blBufferSize>&                 operator=(const blAnyIterator<blDataType,blBufferSize>& iterator)
+    {
+        if(this != &iterator)
+        {
+            this->reset();
+
+            if(iterator.m_vtable)
+                iterator.m_vtable->copy(m_buffer,iterator.m_buffer);
+
+            m_vtable = iterator.m_vtable;
+        }
+
+        return (*this);
+    }
+
+    blAnyIterator<blDataType,blBufferSize>&                 operator=(blAnyIterator<blDataType,blBufferSize>&& iterator)
+    {
+        if(this != &iterator)
+        {
+            this->reset();
+
+            if(iterator.m_vtable)
+                iterator.m_vtable->move(m_buffer,iterator.m_buffer);
+
+            m_vtable = iterator.m_vtable;
+        }
+
+        return (*this);
+    }
+
+public: // Dereferencing operators
+
+    blDataType&                                             operator*()const{return m_vtable->dereference(m_buffer);}
+    blDataType*                                             operator->()const{return &(m_vtable->dereference(m_buffer));}
+
+public: // Overloaded operators
+
+    // Equality and
+    // inequality
+    // operators
+
+    bool                                                    operator==(const blAnyIterator<blDataType,blBufferSize>& iterator)const
+    {
+        if(m_vtable != iterator.m_vtable)
+            return false;
+
+        return (m_vtable == nullptr || m_vtable->equal(m_buffer,iterator.m_buffer));
+    }
+
+    bool                                                    operator!=(const blAnyIterator<blDataType,blBufferSize>& iterator)const
+    {
+        return !((*this) == iterator);
+    }
+
+    // Ordering operators
+
+    bool                                                    operator<(const blAnyIterator<blDataType,blBufferSize>& iterator)const{return ((*this) - iterator < 0);}
+    bool                                                    operator>(const blAnyIterator<blDataType,blBufferSize>& iterator)const{return ((*this) - iterator > 0);}
+    bool                                                    operator<=(const blAnyIterator<blDataType,blBufferSize>& iterator)const{return ((*this) - iterator <= 0);}
+    bool                                                    operator>=(const blAnyIterator<blDataType,blBufferSize>& iterator)const{return ((*this) - iterator >= 0);}
+
+    // Bool operator
+    // so that this
+    // iterator can be
+    // used in if statements
+
+    explicit operator                                       bool()const
+    {
+        return (m_vtable != nullptr && m_vtable->isValid(m_buffer));
+    }
+
+    // Increment/decrement
+    // operators
+
+    blAnyIterator<blDataType,blBufferSize>&                 operator++(){m_vtable->advance(m_buffer,1);return (*this);}
+    blAnyIterator<blDataType,blBufferSize>&                 operator--(){m_vtable->advance(m_buffer,-1);return (*this);}
+    blAnyIterator<blDataType,blBufferSize>                  operator++(int){auto TempIter(*this);m_vtable->advance(m_buffer,1);return TempIter;}
+    blAnyIterator<blDataType,blBufferSize>                  operator--(int){auto TempIter(*this);m_vtable->advance(m_buffer,-1);return TempIter;}
+
+    // Operators used to
+    // advance the iterator
+
+    blAnyIterator<blDataType,blBufferSize>&                 operator+=(const ptrdiff_t& Offset){m_vtable->advance(m_buffer,Offset);return (*this);}
+    blAnyIterator<blDataType,blBufferSize>&                 operator-=(const ptrdiff_t& Offset){m_vtable->advance(m_buffer,-Offset);return (*this);}
+    blAnyIterator<blDataType,blBufferSize>                  operator+(const ptrdiff_t& Offset)const{auto NewIter(*this);NewIter += Offset;return NewIter;}
+    blAnyIterator<blDataType,blBufferSize>                  operator-(const ptrdiff_t& Offset)const{auto NewIter(*this);NewIter -= Offset;return NewIter;}
+
+    blDataType&                                             operator[](const ptrdiff_t& Offset)const{return (*((*this) + Offset));}
+
+    // Operator used
+    // to calculate
+    // the distance
+    // between two
+    // iterators
+
+    ptrdiff_t                                               operator-(const blAnyIterator<blDataType,blBufferSize>& iterator)const
+    {
+        return m_vtable->distance(iterator.m_buffer,m_buffer);
+    }
+
+public: // Public functions
+
+    // Functions used to take
+    // the next segment of up
+    // to "n" contiguous elements
+    // and move the iterator past
+    // it, the segment is empty
+    // once the iterator reaches
+    // the container's end
+
+    blBatchType                                             next_n(const size_t& n)
+    {
+        if(!m_vtable)
+            return blBatchType();
+
+        return m_vtable->next_n(m_buffer,n);
+    }
+
+    blBatchType                                             take_batch(const size_t& n){return this->next_n(n);}
+
+    // Function used to know
+    // whether an iterator
+    // is being held
+
+    bool                                                    hasIterator()const{return (m_vtable != nullptr);}
+
+    // Function used to drop
+    // the held iterator
+
+    void                                                    reset()
+    {
+        if(m_vtable)
+            m_vtable->destroy(m_buffer);
+
+        m_vtable = nullptr;
+    }
+
+private: // Private variables
+
+    // The buffer holding
+    // the erased iterator
+
+    alignas(std::max_align_t) unsigned char                 m_buffer[blBufferSize];
+
+    // The functions used to
+    // operate the iterator
+
+    const blAnyIteratorVTable<blDataType>*                  m_vtable;
+};
+//-------------------------------------------------------------------
+
+
+#endif // BL_ANYITERATOR_HPP
@@ -13,6 +13,11 @@
 //                  it easy to work with iterators
 //                  defined in this library
 //
+//                  The optional "blAlignment" parameter
+//                  aligns the array's data, for example
+//                  to 32/64 bytes for SIMD loads or to
+//                  whole cache lines (see blAlignedArray)
+//
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
 //                  navyenzo@gmail.com
@@ -31,10 +36,13 @@
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
+template<typename blDataType,size_t blArraySize,size_t blAlignment = alignof(blDataType)>
 
 class blArray
 {
+    static_assert(blAlignment >= alignof(blDataType) && (blAlignment & (blAlignment - 1)) == 0,
+                  "blArray alignment has to be a power of two not smaller than the element's own alignment");
+
 public: // Public typedefs
 
     typedef blRawIterator<blDataType>                       iterator;
@@ -51,11 +59,11 @@ public: // Constructors and destructors
 
     // Copy constructor
 
-    blArray(const blArray<blDataType,blArraySize>& array) = default;
+    blArray(const blArray<blDataType,blArraySize,blAlignment>& array) = default;
 
     // Move constructor
 
-    blArray(blArray<blDataType,blArraySize>&& array) = default;
+    blArray(blArray<blDataType,blArraySize,blAlignment>&& array) = default;
 
     // Initializer-list constructor
 
@@ -66,8 +74,8 @@ public: // Constructors and destructors
     // size and/or different
     // data type array
 
-    template<typename blDataType2,size_t blArraySize2>
-    blArray(const blArray<blDataType2,blArraySize2>& array);
+    template<typename blDataType2,size_t blArraySize2,size_t blAlignment2>
+    blArray(const blArray<blDataType2,blArraySize2,blAlignment2>& array);
 
     // Constructor using
     // a raw array
@@ -82,6 +90,13 @@ public: // Constructors and destructors
     blArray(blIteratorType sourceBegin,
             blIteratorType sourceEnd);
 
+    // Constructor evaluating
+    // an expression (see
+    // blExpression.hpp)
+
+    template<typename blExpressionType>
+    blArray(const blExpression<blExpressionType>& expression);
+
     // Destructor
 
     ~blArray()
@@ -90,23 +105,26 @@ public: // Constructors and destructors
 
 public: // Assignment operators
 
-    blArray<blDataType,blArraySize>&                        operator=(const blArray<blDataType,blArraySize>& array) = default;
+    blArray<blDataType,blArraySize,blAlignment>&                        operator=(const blArray<blDataType,blArraySize,blAlignment>& array) = default;
 
-    template<typename blDataType2,size_t blArraySize2>
-    blArray<blDataType,blArraySize>&                        operator=(const blArray<blDataType2,blArraySize2>& array);
+    template<typename blDataType2,size_t blArraySize2,size_t blAlignment2>
+    blArray<blDataType,blArraySize,blAlignment>&                        operator=(const blArray<blDataType2,blArraySize2,blAlignment2>& array);
 
-    blArray<blDataType,blArraySize>&                        operator=(std::initializer_list<blDataType> theList);
+    blArray<blDataType,blArraySize,blAlignment>&                        operator=(std::initializer_list<blDataType> theList);
 
     template<typename blDataType2,size_t blArraySize2>
-    blArray<blDataType,blArraySize>&                        operator=(const blDataType2 (&staticArray)[blArraySize2]);
+    blArray<blDataType,blArraySize,blAlignment>&                        operator=(const blDataType2 (&staticArray)[blArraySize2]);
+
+    template<typename blExpressionType>
+    blArray<blDataType,blArraySize,blAlignment>&                        operator=(const blExpression<blExpressionType>& expression);
 
 public: // Public functions
 
     // Additional operator
     // overloads
 
-    bool                                                    operator==(const blArray<blDataType,blArraySize>& array)const;
-    bool                                                    operator!=(const blArray<blDataType,blArraySize>& array)const;
+    bool                                                    operator==(const blArray<blDataType,blArraySize,blAlignment>& array)const;
+    bool                                                    operator!=(const blArray<blDataType,blArraySize,blAlignment>& array)const;
 
     // Element access
     // functions
@@ -128,7 +146,7 @@ public: // Public functions
     // two arrays of
     // equal length
 
-    void                                                    swap(const blArray<blDataType,blArraySize>& Array);
+    void                                                    swap(const blArray<blDataType,blArraySize,blAlignment>& Array);
 
     // Function used to
     // fill the array
@@ -173,8 +191,15 @@ public: // Public functions
 private: // Private data
 
     // The raw array
+    //
+    // NOTE:    Aligning the first element
+    //          also rounds the array's size
+    //          up to a multiple of the
+    //          alignment, so a cache line
+    //          aligned array never shares
+    //          its last cache line
 
-    blDataType                                              m_container[blArraySize];
+    alignas(blAlignment) blDataType                         m_container[blArraySize];
 
     // The null end
     // element useful
@@ -188,16 +213,16 @@ private: // Private data
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blArray<blDataType,blArraySize>::blArray() : m_nullChar(0)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blArray<blDataType,blArraySize,blAlignment>::blArray() : m_nullChar(0)
 {
 }
 //-------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blArray<blDataType,blArraySize>::blArray(std::initializer_list<blDataType> theList) : m_nullChar(0)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blArray<blDataType,blArraySize,blAlignment>::blArray(std::initializer_list<blDataType> theList) : m_nullChar(0)
 {
     auto Iter1 = this->begin();
     auto Iter2 = theList.begin();
@@ -213,15 +238,15 @@ inline blArray<blDataType,blArraySize>::blArray(std::initializer_list<blDataType
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-template<typename blDataType2,size_t blArraySize2>
-inline blArray<blDataType,blArraySize>::blArray(const blArray<blDataType2,blArraySize2>& array) : m_nullChar(0)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+template<typename blDataType2,size_t blArraySize2,size_t blAlignment2>
+inline blArray<blDataType,blArraySize,blAlignment>::blArray(const blArray<blDataType2,blArraySize2,blAlignment2>& array) : m_nullChar(0)
 {
     auto Iter1 = this->begin();
-    auto Iter2 = array.begin();
+    auto Iter2 = array.cbegin();
 
     for(;
-        Iter1 != this->end(),Iter2 != array.end();
+        Iter1 != this->end() && Iter2 != array.cend();
         ++Iter1,++Iter2)
     {
         (*Iter1) = (*Iter2);
@@ -231,9 +256,9 @@ inline blArray<blDataType,blArraySize>::blArray(const blArray<blDataType2,blArra
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
 template<typename blDataType2,size_t blArraySize2>
-inline blArray<blDataType,blArraySize>::blArray(const blDataType2 (&staticArray)[blArraySize2]) : m_nullChar(0)
+inline blArray<blDataType,blArraySize,blAlignment>::blArray(const blDataType2 (&staticArray)[blArraySize2]) : m_nullChar(0)
 {
     auto Iter1 = this->begin();
 
@@ -248,9 +273,9 @@ inline blArray<blDataType,blArraySize>::blArray(const blDataType2 (&staticArray)
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
 template<typename blIteratorType>
-inline blArray<blDataType,blArraySize>::blArray(blIteratorType sourceBegin,
+inline blArray<blDataType,blArraySize,blAlignment>::blArray(blIteratorType sourceBegin,
                                                 blIteratorType sourceEnd) : m_nullChar(0)
 {
     auto Iter1 = this->begin();
@@ -266,17 +291,17 @@ inline blArray<blDataType,blArraySize>::blArray(blIteratorType sourceBegin,
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-template<typename blDataType2,size_t blArraySize2>
-inline blArray<blDataType,blArraySize>& blArray<blDataType,blArraySize>::operator=(const blArray<blDataType2,blArraySize2>& array)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+template<typename blDataType2,size_t blArraySize2,size_t blAlignment2>
+inline blArray<blDataType,blArraySize,blAlignment>& blArray<blDataType,blArraySize,blAlignment>::operator=(const blArray<blDataType2,blArraySize2,blAlignment2>& array)
 {
-    if(this != &array)
+    if(static_cast<const void*>(this) != static_cast<const void*>(&array))
     {
         auto iter1 = this->begin();
-        auto iter2 = array.begin();
+        auto iter2 = array.cbegin();
 
         for(;
-            iter1 != this->end(),iter2 != array.end();
+            iter1 != this->end() && iter2 != array.cend();
             ++iter1,++iter2)
         {
             (*iter1) = (*iter2);
@@ -289,8 +314,35 @@ inline blArray<blDataType,blArraySize>& blArray<blDataType,blArraySize>::operato
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blArray<blDataType,blArraySize>& blArray<blDataType,blArraySize>::operator=(std::initializer_list<blDataType> theList)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+template<typename blExpressionType>
+inline blArray<blDataType,blArraySize,blAlignment>::blArray(const blExpression<blExpressionType>& expression) : m_nullChar(0)
+{
+    (*this) = expression;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+template<typename blExpressionType>
+inline blArray<blDataType,blArraySize,blAlignment>& blArray<blDataType,blArraySize,blAlignment>::operator=(const blExpression<blExpressionType>& expression)
+{
+    static_assert(blExpressionType::blStaticSize == blDynamicSize ||
+                  blExpressionType::blStaticSize == blAnySize ||
+                  blExpressionType::blStaticSize == blArraySize,
+                  "blArray assigned an expression of a different size");
+
+    blEvaluateExpression(m_container,blArraySize,expression);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blArray<blDataType,blArraySize,blAlignment>& blArray<blDataType,blArraySize,blAlignment>::operator=(std::initializer_list<blDataType> theList)
 {
     auto Iter1 = this->begin();
     auto Iter2 = theList.begin();
@@ -308,8 +360,8 @@ inline blArray<blDataType,blArraySize>& blArray<blDataType,blArraySize>::operato
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline bool blArray<blDataType,blArraySize>::operator==(const blArray<blDataType,blArraySize>& array)const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline bool blArray<blDataType,blArraySize,blAlignment>::operator==(const blArray<blDataType,blArraySize,blAlignment>& array)const
 {
     if(this == &array)
         return true;
@@ -331,8 +383,8 @@ inline bool blArray<blDataType,blArraySize>::operator==(const blArray<blDataType
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline bool blArray<blDataType,blArraySize>::operator!=(const blArray<blDataType,blArraySize>& array)const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline bool blArray<blDataType,blArraySize,blAlignment>::operator!=(const blArray<blDataType,blArraySize,blAlignment>& array)const
 {
     return !( (*this) == array );
 }
@@ -340,8 +392,8 @@ inline bool blArray<blDataType,blArraySize>::operator!=(const blArray<blDataType
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blDataType& blArray<blDataType,blArraySize>::operator[](const size_t elementIndex)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blDataType& blArray<blDataType,blArraySize,blAlignment>::operator[](const size_t elementIndex)
 {
     return m_container[elementIndex];
 }
@@ -349,8 +401,8 @@ inline blDataType& blArray<blDataType,blArraySize>::operator[](const size_t elem
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline const blDataType& blArray<blDataType,blArraySize>::operator[](const size_t elementIndex)const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline const blDataType& blArray<blDataType,blArraySize,blAlignment>::operator[](const size_t elementIndex)const
 {
     return m_container[elementIndex];
 }
@@ -358,8 +410,8 @@ inline const blDataType& blArray<blDataType,blArraySize>::operator[](const size_
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline size_t blArray<blDataType,blArraySize>::length()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline size_t blArray<blDataType,blArraySize,blAlignment>::length()const
 {
     return blArraySize;
 }
@@ -367,8 +419,8 @@ inline size_t blArray<blDataType,blArraySize>::length()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline size_t blArray<blDataType,blArraySize>::size()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline size_t blArray<blDataType,blArraySize,blAlignment>::size()const
 {
     return blArraySize;
 }
@@ -376,8 +428,8 @@ inline size_t blArray<blDataType,blArraySize>::size()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline size_t blArray<blDataType,blArraySize>::max_size()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline size_t blArray<blDataType,blArraySize,blAlignment>::max_size()const
 {
     return blArraySize;
 }
@@ -385,8 +437,8 @@ inline size_t blArray<blDataType,blArraySize>::max_size()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline bool blArray<blDataType,blArraySize>::empty()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline bool blArray<blDataType,blArraySize,blAlignment>::empty()const
 {
     return (blArraySize != 0);
 }
@@ -394,8 +446,8 @@ inline bool blArray<blDataType,blArraySize>::empty()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline void blArray<blDataType,blArraySize>::swap(const blArray<blDataType, blArraySize>& Array)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline void blArray<blDataType,blArraySize,blAlignment>::swap(const blArray<blDataType,blArraySize,blAlignment>& Array)
 {
     blDataType TempValue;
 
@@ -410,8 +462,8 @@ inline void blArray<blDataType,blArraySize>::swap(const blArray<blDataType, blAr
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline void blArray<blDataType,blArraySize>::fill(const blDataType& value)
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline void blArray<blDataType,blArraySize,blAlignment>::fill(const blDataType& value)
 {
     for(size_t i = 0; i < blArraySize; ++i)
         m_container[i] = value;
@@ -420,8 +472,8 @@ inline void blArray<blDataType,blArraySize>::fill(const blDataType& value)
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blDataType& blArray<blDataType,blArraySize>::front()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blDataType& blArray<blDataType,blArraySize,blAlignment>::front()
 {
     return m_container[0];
 }
@@ -429,8 +481,8 @@ inline blDataType& blArray<blDataType,blArraySize>::front()
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline const blDataType& blArray<blDataType,blArraySize>::front()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline const blDataType& blArray<blDataType,blArraySize,blAlignment>::front()const
 {
     return m_container[0];
 }
@@ -438,8 +490,8 @@ inline const blDataType& blArray<blDataType,blArraySize>::front()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blDataType& blArray<blDataType,blArraySize>::back()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blDataType& blArray<blDataType,blArraySize,blAlignment>::back()
 {
     return m_container[blArraySize - 1];
 }
@@ -447,8 +499,8 @@ inline blDataType& blArray<blDataType,blArraySize>::back()
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline const blDataType& blArray<blDataType,blArraySize>::back()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline const blDataType& blArray<blDataType,blArraySize,blAlignment>::back()const
 {
     return m_container[blArraySize - 1];
 }
@@ -456,8 +508,8 @@ inline const blDataType& blArray<blDataType,blArraySize>::back()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline blDataType* blArray<blDataType,blArraySize>::data()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline blDataType* blArray<blDataType,blArraySize,blAlignment>::data()
 {
     return &m_container[0];
 }
@@ -465,8 +517,8 @@ inline blDataType* blArray<blDataType,blArraySize>::data()
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline const blDataType* blArray<blDataType,blArraySize>::data()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline const blDataType* blArray<blDataType,blArraySize,blAlignment>::data()const
 {
     return &m_container[0];
 }
@@ -474,8 +526,8 @@ inline const blDataType* blArray<blDataType,blArraySize>::data()const
 
 
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline const blDataType* blArray<blDataType,blArraySize>::c_str()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline const blDataType* blArray<blDataType,blArraySize,blAlignment>::c_str()const
 {
     return &m_container[0];
 }
@@ -485,53 +537,66 @@ inline const blDataType* blArray<blDataType,blArraySize>::c_str()const
 //-------------------------------------------------------------------
 // The iterators
 //-------------------------------------------------------------------
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::iterator blArray<blDataType,blArraySize>::begin()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::iterator blArray<blDataType,blArraySize,blAlignment>::begin()
 {
     return &(m_container[0]);
 }
 
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::iterator blArray<blDataType,blArraySize>::end()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::iterator blArray<blDataType,blArraySize,blAlignment>::end()
 {
     return &(m_container[blArraySize]);
 }
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::const_iterator blArray<blDataType,blArraySize>::cbegin()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::const_iterator blArray<blDataType,blArraySize,blAlignment>::cbegin()const
 {
     return &(m_container[0]);
 }
 
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::const_iterator blArray<blDataType,blArraySize>::cend()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::const_iterator blArray<blDataType,blArraySize,blAlignment>::cend()const
 {
     return &(m_container[blArraySize]);
 }
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::reverse_iterator blArray<blDataType,blArraySize>::rbegin()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::reverse_iterator blArray<blDataType,blArraySize,blAlignment>::rbegin()
 {
     return &(m_container[blArraySize - 1]);
 }
 
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::reverse_iterator blArray<blDataType,blArraySize>::rend()
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::reverse_iterator blArray<blDataType,blArraySize,blAlignment>::rend()
 {
     return &(m_container[-1]);
 }
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::const_reverse_iterator blArray<blDataType,blArraySize>::crbegin()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::const_reverse_iterator blArray<blDataType,blArraySize,blAlignment>::crbegin()const
 {
     return &(m_container[blArraySize - 1]);
 }
 
-template<typename blDataType,size_t blArraySize>
-inline typename blArray<blDataType,blArraySize>::const_reverse_iterator blArray<blDataType,blArraySize>::crend()const
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+inline typename blArray<blDataType,blArraySize,blAlignment>::const_reverse_iterator blArray<blDataType,blArraySize,blAlignment>::crend()const
 {
     return &(m_container[-1]);
 }
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// The cache line size assumed by
+// the library, and an array whose
+// data is aligned (and padded) to
+// whole cache lines by default
+//-------------------------------------------------------------------
+const size_t                                                blCacheLineSize = 64;
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment = blCacheLineSize>
+using blAlignedArray = blArray<blDataType,blArraySize,blAlignment>;
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 // Function used to automatically deduct
 // the type and size of array from a raw
@@ -0,0 +1,326 @@
+#ifndef BL_ARRAYALGORITHMS_HPP
+#define BL_ARRAYALGORITHMS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blArrayAlgorithms.hpp
+// CLASS:           None
+// BASE CLASS:      None
+//
+// PURPOSE:         Algorithms over blArrays which use the arrays'
+//                  static size to fully unroll their loops:
+//
+//                  - blForEach -- Calls a functor on every element
+//                  - blTransform -- Writes a functor's results of one
+//                                   or two arrays into another one
+//                  - blReduce -- Folds the elements, in order, into
+//                                an initial value
+//                  - blDot -- The dot product of two arrays
+//                  - blEqual -- Whether two arrays are equal
+//
+//                  Arrays of up to "blUnrollThreshold" elements
+//                  (vectors, quaternions, small matrices) are
+//                  expanded at compile time into straight-line
+//                  code, while bigger arrays use plain loops the
+//                  compiler can vectorize.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blArray
+//
+// NOTES:           - The library only needs c++11, so it defines
+//                    its own index sequence and expands it through
+//                    braced initializer lists, which evaluate their
+//                    elements in order, instead of using c++17
+//                    fold expressions
+//
+//                  - blEqual on unrolled arrays compares every
+//                    element without branching
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Arrays of up to this many elements
+// get their loops fully unrolled
+//-------------------------------------------------------------------
+const size_t                                                blUnrollThreshold = 16;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A compile time sequence of indices
+// (like c++14's std::index_sequence)
+//-------------------------------------------------------------------
+template<size_t... blIndices>
+struct blIndexSequence
+{
+};
+
+template<size_t blSize,size_t... blIndices>
+struct blMakeIndexSequenceHelper : blMakeIndexSequenceHelper<blSize - 1,blSize - 1,blIndices...>
+{
+};
+
+template<size_t... blIndices>
+struct blMakeIndexSequenceHelper<0,blIndices...>
+{
+    typedef blIndexSequence<blIndices...>                   type;
+};
+
+template<size_t blSize>
+using blMakeIndexSequence = typename blMakeIndexSequenceHelper<blSize>::type;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Used to choose between the unrolled
+// and the looped implementations, the
+// index sequence is only built for
+// arrays that get unrolled
+//-------------------------------------------------------------------
+struct blLoopIndices
+{
+    typedef blLoopIndices                                   type;
+};
+
+template<size_t blArraySize>
+using blUnrollIndices = typename std::conditional<(blArraySize <= blUnrollThreshold),
+                                                  blMakeIndexSequenceHelper<blArraySize>,
+                                                  blLoopIndices>::type::type;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// blForEach
+//-------------------------------------------------------------------
+template<typename blArrayType,typename blFunctorType,size_t... blIndices>
+inline void blForEach(blArrayType& array,
+                      blFunctorType& functor,
+                      blIndexSequence<blIndices...>)
+{
+    (void)std::initializer_list<int>{(functor(array[blIndices]),0)...};
+}
+
+template<typename blArrayType,typename blFunctorType>
+inline void blForEach(blArrayType& array,
+                      blFunctorType& functor,
+                      blLoopIndices)
+{
+    for(size_t i = 0; i < array.size(); ++i)
+        functor(array[i]);
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blFunctorType>
+inline blFunctorType blForEach(blArray<blDataType,blArraySize,blAlignment>& array,
+                               blFunctorType functor)
+{
+    blForEach(array,functor,blUnrollIndices<blArraySize>());
+    return functor;
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blFunctorType>
+inline blFunctorType blForEach(const blArray<blDataType,blArraySize,blAlignment>& array,
+                               blFunctorType functor)
+{
+    blForEach(array,functor,blUnrollIndices<blArraySize>());
+    return functor;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// blTransform
+//-------------------------------------------------------------------
+template<typename blSourceArrayType,typename blDestinationArrayType,typename blFunctorType,size_t... blIndices>
+inline void blTransform(const blSourceArrayType& source,
+                        blDestinationArrayType& destination,
+                        blFunctorType& functor,
+                        blIndexSequence<blIndices...>)
+{
+    (void)std::initializer_list<int>{(destination[blIndices] = functor(source[blIndices]),0)...};
+}
+
+template<typename blSourceArrayType1,typename blSourceArrayType2,typename blDestinationArrayType,typename blFunctorType,size_t... blIndices>
+inline void blTransform(const blSourceArrayType1& source1,
+                        const blSourceArrayType2& source2,
+                        blDestinationArrayType& destination,
+                        blFunctorType& functor,
+                        blIndexSequence<blIndices...>)
+{
+    (void)std::initializer_list<int>{(destination[blIndices] = functor(source1[blIndices],source2[blIndices]),0)...};
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,
+         typename blDataType2,size_t blAlignment2,
+         typename blFunctorType>
+inline void blTransform(const blArray<blDataType,blArraySize,blAlignment>& source,
+                        blArray<blDataType2,blArraySize,blAlignment2>& destination,
+                        blFunctorType functor)
+{
+    blTransform(source,destination,functor,blUnrollIndices<blArraySize>());
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,
+         typename blDataType2,size_t blAlignment2,
+         typename blDataType3,size_t blAlignment3,
+         typename blFunctorType>
+inline void blTransform(const blArray<blDataType,blArraySize,blAlignment>& source1,
+                        const blArray<blDataType2,blArraySize,blAlignment2>& source2,
+                        blArray<blDataType3,blArraySize,blAlignment3>& destination,
+                        blFunctorType functor)
+{
+    blTransform(source1,source2,destination,functor,blUnrollIndices<blArraySize>());
+}
+
+template<typename blSourceArrayType,typename blDestinationArrayType,typename blFunctorType>
+inline void blTransform(const blSourceArrayType& source,
+                        blDestinationArrayType& destination,
+                        blFunctorType& functor,
+                        blLoopIndices)
+{
+    for(size_t i = 0; i < source.size(); ++i)
+        destination[i] = functor(source[i]);
+}
+
+template<typename blSourceArrayType1,typename blSourceArrayType2,typename blDestinationArrayType,typename blFunctorType>
+inline void blTransform(const blSourceArrayType1& source1,
+                        const blSourceArrayType2& source2,
+                        blDestinationArrayType& destination,
+                        blFunctorType& functor,
+                        blLoopIndices)
+{
+    for(size_t i = 0; i < source1.size(); ++i)
+        destination[i] = functor(source1[i],source2[i]);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// blReduce
+//
+// NOTE:    The elements are folded in
+//          order, from the first to
+//          the last one
+//-------------------------------------------------------------------
+template<typename blArrayType,typename blResultType,typename blFunctorType,size_t... blIndices>
+inline void blReduce(const blArrayType& array,
+                     blResultType& result,
+                     blFunctorType& functor,
+                     blIndexSequence<blIndices...>)
+{
+    (void)std::initializer_list<int>{(result = functor(result,array[blIndices]),0)...};
+}
+
+template<typename blArrayType,typename blResultType,typename blFunctorType>
+inline void blReduce(const blArrayType& array,
+                     blResultType& result,
+                     blFunctorType& functor,
+                     blLoopIndices)
+{
+    for(size_t i = 0; i < array.size(); ++i)
+        result = functor(result,array[i]);
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blResultType,typename blFunctorType>
+inline blResultType blReduce(const blArray<blDataType,blArraySize,blAlignment>& array,
+                             blResultType initialValue,
+                             blFunctorType functor)
+{
+    blReduce(array,initialValue,functor,blUnrollIndices<blArraySize>());
+    return initialValue;
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blResultType>
+inline blResultType blReduce(const blArray<blDataType,blArraySize,blAlignment>& array,
+                             blResultType initialValue)
+{
+    return blReduce(array,initialValue,std::plus<blResultType>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// blDot
+//-------------------------------------------------------------------
+template<typename blArrayType1,typename blArrayType2,typename blResultType,size_t... blIndices>
+inline void blDot(const blArrayType1& array1,
+                  const blArrayType2& array2,
+                  blResultType& result,
+                  blIndexSequence<blIndices...>)
+{
+    (void)std::initializer_list<int>{(result += array1[blIndices] * array2[blIndices],0)...};
+}
+
+template<typename blArrayType1,typename blArrayType2,typename blResultType>
+inline void blDot(const blArrayType1& array1,
+                  const blArrayType2& array2,
+                  blResultType& result,
+                  blLoopIndices)
+{
+    for(size_t i = 0; i < array1.size(); ++i)
+        result += array1[i] * array2[i];
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,
+         typename blDataType2,size_t blAlignment2>
+inline auto blDot(const blArray<blDataType,blArraySize,blAlignment>& array1,
+                  const blArray<blDataType2,blArraySize,blAlignment2>& array2)->decltype(array1[0] * array2[0])
+{
+    decltype(array1[0] * array2[0]) result(0);
+
+    blDot(array1,array2,result,blUnrollIndices<blArraySize>());
+
+    return result;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// blEqual
+//-------------------------------------------------------------------
+template<typename blArrayType1,typename blArrayType2,size_t... blIndices>
+inline bool blEqual(const blArrayType1& array1,
+                    const blArrayType2& array2,
+                    blIndexSequence<blIndices...>)
+{
+    bool areEqual = true;
+
+    (void)std::initializer_list<int>{(areEqual &= bool(array1[blIndices] == array2[blIndices]),0)...};
+
+    return areEqual;
+}
+
+template<typename blArrayType1,typename blArrayType2>
+inline bool blEqual(const blArrayType1& array1,
+                    const blArrayType2& array2,
+                    blLoopIndices)
+{
+    for(size_t i = 0; i < array1.size(); ++i)
+    {
+        if(!(array1[i] == array2[i]))
+            return false;
+    }
+
+    return true;
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,
+         typename blDataType2,size_t blAlignment2>
+inline bool blEqual(const blArray<blDataType,blArraySize,blAlignment>& array1,
+                    const blArray<blDataType2,blArraySize,blAlignment2>& array2)
+{
+    return blEqual(array1,array2,blUnrollIndices<blArraySize>());
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_ARRAYALGORITHMS_HPP
@@ -0,0 +1,827 @@
+#ifndef BL_BITARRAY_HPP
+#define BL_BITARRAY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blBitArray.hpp
+// CLASS:           blBitReference
+//                  blBitIterator
+//                  blBitArrayBase
+//                  blBitArray
+//                  blRawBitArrayWrapper
+// BASE CLASS:      None
+//
+// PURPOSE:         Arrays of bits packed into 64-bit words, taking
+//                  an eighth of the memory of an array of bools:
+//
+//                  - blBitArray -- The number of bits is a template
+//                                  parameter and the words are
+//                                  stored in the array itself.
+//
+//                  - blRawBitArrayWrapper -- Wraps existing words
+//                                            holding a run time
+//                                            number of bits, without
+//                                            owning them.
+//
+//                  Single bits are accessed through proxy references
+//                  (blBitReference), so both arrays work with the
+//                  smart iterators (blLinearIterator and so on),
+//                  while count, find_first, find_next, any, all and
+//                  the bitwise operators work a whole word at a time.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:
+//
+// NOTES:           - Bit "i" is bit "i % 64" of word "i / 64"
+//
+//                  - The unused bits of the last word are
+//                    masked out when reading and are never
+//                    changed when writing, so wrapped words
+//                    can be shared with other data
+//
+//                  - With gcc/clang the bit counts use
+//                    __builtin_popcountll/__builtin_ctzll,
+//                    which become single popcnt/tzcnt
+//                    instructions when building with
+//                    -mpopcnt -mbmi (or -march=native)
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The word the bits are packed into
+//-------------------------------------------------------------------
+typedef uint64_t                                            blBitWord;
+
+const size_t                                                blBitsPerWord = 64;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to count the set bits
+// and the trailing zero bits of a word
+//
+// NOTE:    blCountTrailingZeros expects
+//          a word that is not zero
+//-------------------------------------------------------------------
+inline size_t blPopCount(blBitWord word)
+{
+    #if defined(__GNUC__) || defined(__clang__)
+
+        return static_cast<size_t>(__builtin_popcountll(word));
+
+    #else
+
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+
+        return static_cast<size_t>((word * 0x0101010101010101ULL) >> 56);
+
+    #endif
+}
+
+inline size_t blCountTrailingZeros(blBitWord word)
+{
+    #if defined(__GNUC__) || defined(__clang__)
+
+        return static_cast<size_t>(__builtin_ctzll(word));
+
+    #else
+
+        return blPopCount((word & (0 - word)) - 1);
+
+    #endif
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Proxy reference to a single bit
+//-------------------------------------------------------------------
+class blBitReference
+{
+public:
+
+    blBitReference(blBitWord* word,
+                   const blBitWord& mask)
+                   : m_word(word),
+                     m_mask(mask)
+    {
+    }
+
+    blBitReference(const blBitReference& bitReference) = default;
+    ~blBitReference(){}
+
+    // Assigning to a reference
+    // assigns to the bit, not
+    // to the reference
+
+    blBitReference&                             operator=(const bool& value){if(value) (*m_word) |= m_mask; else (*m_word) &= ~m_mask;return (*this);}
+    blBitReference&                             operator=(const blBitReference& bitReference){return ((*this) = bool(bitReference));}
+
+    blBitReference&                             operator&=(const bool& value){if(!value) (*m_word) &= ~m_mask;return (*this);}
+    blBitReference&                             operator|=(const bool& value){if(value) (*m_word) |= m_mask;return (*this);}
+    blBitReference&                             operator^=(const bool& value){if(value) (*m_word) ^= m_mask;return (*this);}
+
+    operator                                    bool()const{return (((*m_word) & m_mask) != 0);}
+    bool                                        operator~()const{return (((*m_word) & m_mask) == 0);}
+
+    blBitReference&                             flip(){(*m_word) ^= m_mask;return (*this);}
+
+private:
+
+    blBitWord*                                  m_word;
+    blBitWord                                   m_mask;
+};
+
+// Proxy references are temporaries,
+// so they're swapped by value
+
+inline void swap(blBitReference bitReference1,blBitReference bitReference2)
+{
+    bool temp = bitReference1;
+    bitReference1 = bool(bitReference2);
+    bitReference2 = temp;
+}
+
+inline void swap(blBitReference bitReference1,bool& value)
+{
+    bool temp = bitReference1;
+    bitReference1 = value;
+    value = temp;
+}
+
+inline void swap(bool& value,blBitReference bitReference2)
+{
+    swap(bitReference2,value);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Random access iterator over packed bits
+//
+// NOTE:    Iterators over non-const words
+//          dereference into blBitReference
+//          proxies, iterators over const
+//          words into plain bools
+//-------------------------------------------------------------------
+template<typename blWordType>
+
+class blBitIterator : public std::iterator<std::random_access_iterator_tag,
+                                           bool,
+                                           ptrdiff_t,
+                                           void,
+                                           typename std::conditional<std::is_const<blWordType>::value,
+                                                                     bool,
+                                                                     blBitReference>::type>
+{
+public: // Public typedefs
+
+    typedef typename std::conditional<std::is_const<blWordType>::value,
+                                      bool,
+                                      blBitReference>::type blReferenceType;
+
+public:
+
+    blBitIterator(blWordType* words = nullptr,
+                  const ptrdiff_t& index = 0)
+                  : m_words(words),
+                    m_index(index)
+    {
+    }
+
+    blBitIterator(const blBitIterator<blWordType>& iterator) = default;
+    ~blBitIterator(){}
+
+    // Conversion from an iterator
+    // over non-const words into an
+    // iterator over const words
+
+    template<typename blOtherWordType,
+             typename = typename std::enable_if<std::is_convertible<blOtherWordType*,blWordType*>::value>::type>
+    blBitIterator(const blBitIterator<blOtherWordType>& iterator)
+                  : m_words(iterator.getWords()),
+                    m_index(iterator.getIndex())
+    {
+    }
+
+    blBitIterator<blWordType>&                  operator=(const blBitIterator<blWordType>& iterator) = default;
+
+    bool                                        operator==(const blBitIterator<blWordType>& iterator)const{return (m_index == iterator.getIndex() && m_words == iterator.getWords());}
+    bool                                        operator!=(const blBitIterator<blWordType>& iterator)const{return !((*this) == iterator);}
+    bool                                        operator<(const blBitIterator<blWordType>& iterator)const{return (m_index < iterator.getIndex());}
+    bool                                        operator>(const blBitIterator<blWordType>& iterator)const{return (m_index > iterator.getIndex());}
+    bool                                        operator<=(const blBitIterator<blWordType>& iterator)const{return (m_index <= iterator.getIndex());}
+    bool                                        operator>=(const blBitIterator<blWordType>& iterator)const{return (m_index >= iterator.getIndex());}
+
+    blBitIterator<blWordType>&                  operator+=(const ptrdiff_t& movement){m_index += movement;return (*this);}
+    blBitIterator<blWordType>&                  operator-=(const ptrdiff_t& movement){m_index -= movement;return (*this);}
+    blBitIterator<blWordType>&                  operator++(){++m_index;return (*this);}
+    blBitIterator<blWordType>&                  operator--(){--m_index;return (*this);}
+    blBitIterator<blWordType>                   operator++(int){auto temp(*this);++m_index;return temp;}
+    blBitIterator<blWordType>                   operator--(int){auto temp(*this);--m_index;return temp;}
+    blBitIterator<blWordType>                   operator+(const ptrdiff_t& movement)const{auto temp(*this);temp.m_index += movement;return temp;}
+    blBitIterator<blWordType>                   operator-(const ptrdiff_t& movement)const{auto temp(*this);temp.m_index -= movement;return temp;}
+
+    ptrdiff_t                                   operator-(const blBitIterator<blWordType>& iterator)const{return (m_index - iterator.getIndex());}
+
+    blReferenceType                             operator*()const{return getBit(m_index,std::is_const<blWordType>());}
+    blReferenceType                             operator[](const ptrdiff_t& offset)const{return getBit(m_index + offset,std::is_const<blWordType>());}
+
+    blWordType*                                 getWords()const{return m_words;}
+    ptrdiff_t                                   getIndex()const{return m_index;}
+
+private:
+
+    bool                                        getBit(const ptrdiff_t& index,std::true_type)const
+    {
+        return ((m_words[index / blBitsPerWord] >> (index % blBitsPerWord)) & 1) != 0;
+    }
+
+    blBitReference                              getBit(const ptrdiff_t& index,std::false_type)const
+    {
+        return blBitReference(&m_words[index / blBitsPerWord],blBitWord(1) << (index % blBitsPerWord));
+    }
+
+    blWordType*                                 m_words;
+    ptrdiff_t                                   m_index;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The bit access and word-at-a-time
+// operations shared by the static
+// bit array and the wrapper
+//
+// NOTE:    The derived array provides
+//          the words through:
+//
+//          - blBitWord* getWords()
+//          - const blBitWord* getWords()const
+//          - size_t size()const
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+
+class blBitArrayBase
+{
+public: // Public typedefs
+
+    typedef bool                                            value_type;
+
+    typedef blBitIterator<blBitWord>                        iterator;
+    typedef blBitIterator<const blBitWord>                  const_iterator;
+
+    typedef std::reverse_iterator<iterator>                 reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>           const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    blBitArrayBase()
+    {
+    }
+
+    ~blBitArrayBase()
+    {
+    }
+
+public: // Public functions
+
+    // Additional operator
+    // overloads
+
+    template<typename blOtherDerivedType>
+    bool                                                    operator==(const blBitArrayBase<blOtherDerivedType>& bitArray)const;
+
+    template<typename blOtherDerivedType>
+    bool                                                    operator!=(const blBitArrayBase<blOtherDerivedType>& bitArray)const{return !((*this) == bitArray);}
+
+    // Element access
+    // functions
+
+    blBitReference                                          operator[](const size_t bitIndex){return blBitReference(&getWords()[bitIndex / blBitsPerWord],blBitWord(1) << (bitIndex % blBitsPerWord));}
+    bool                                                    operator[](const size_t bitIndex)const{return test(bitIndex);}
+
+    bool                                                    test(const size_t& bitIndex)const{return ((getWords()[bitIndex / blBitsPerWord] >> (bitIndex % blBitsPerWord)) & 1) != 0;}
+
+    // Functions used
+    // to return the
+    // array size
+
+    size_t                                                  length()const{return size();}
+    size_t                                                  max_size()const{return size();}
+    bool                                                    empty()const{return (size() == 0);}
+
+    size_t                                                  getNumberOfWords()const{return (size() + blBitsPerWord - 1) / blBitsPerWord;}
+
+    // Functions used to
+    // set, reset or flip
+    // one bit or all bits
+
+    blDerivedType&                                          set(const size_t& bitIndex,const bool& value = true){(*this)[bitIndex] = value;return getDerived();}
+    blDerivedType&                                          reset(const size_t& bitIndex){(*this)[bitIndex] = false;return getDerived();}
+    blDerivedType&                                          flip(const size_t& bitIndex){(*this)[bitIndex].flip();return getDerived();}
+
+    blDerivedType&                                          set();
+    blDerivedType&                                          reset();
+    blDerivedType&                                          flip();
+
+    // Functions used to
+    // count and find the
+    // set bits, a whole
+    // word at a time
+    //
+    // NOTE:    The find functions
+    //          return size() when
+    //          no bit is found,
+    //          find_next looks
+    //          after "bitIndex"
+
+    size_t                                                  count()const;
+    bool                                                    any()const;
+    bool                                                    all()const;
+    bool                                                    none()const{return !any();}
+
+    size_t                                                  find_first()const;
+    size_t                                                  find_next(const size_t& bitIndex)const;
+
+    // Bitwise operators
+    // working a whole word
+    // at a time, on the
+    // bits both arrays have
+
+    template<typename blOtherDerivedType>
+    blDerivedType&                                          operator&=(const blBitArrayBase<blOtherDerivedType>& bitArray){return applyWordOperation(bitArray,[](const blBitWord& word1,const blBitWord& word2){return word1 & word2;});}
+
+    template<typename blOtherDerivedType>
+    blDerivedType&                                          operator|=(const blBitArrayBase<blOtherDerivedType>& bitArray){return applyWordOperation(bitArray,[](const blBitWord& word1,const blBitWord& word2){return word1 | word2;});}
+
+    template<typename blOtherDerivedType>
+    blDerivedType&                                          operator^=(const blBitArrayBase<blOtherDerivedType>& bitArray){return applyWordOperation(bitArray,[](const blBitWord& word1,const blBitWord& word2){return word1 ^ word2;});}
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(getWords(),0);}
+    iterator                                                end(){return iterator(getWords(),static_cast<ptrdiff_t>(size()));}
+    const_iterator                                          cbegin()const{return const_iterator(getWords(),0);}
+    const_iterator                                          cend()const{return const_iterator(getWords(),static_cast<ptrdiff_t>(size()));}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(end());}
+    reverse_iterator                                        rend(){return reverse_iterator(begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(cbegin());}
+
+    // Functions used to
+    // get the derived array
+    // and its words
+
+    blDerivedType&                                          getDerived(){return (*static_cast<blDerivedType*>(this));}
+    const blDerivedType&                                    getDerived()const{return (*static_cast<const blDerivedType*>(this));}
+
+    blBitWord*                                              getWords(){return getDerived().getWords();}
+    const blBitWord*                                        getWords()const{return getDerived().getWords();}
+    size_t                                                  size()const{return getDerived().size();}
+
+private: // Private functions
+
+    // The mask of the
+    // bits used in the
+    // last word
+
+    static blBitWord                                        getLastWordMask(const size_t& numberOfBits)
+    {
+        return (numberOfBits % blBitsPerWord == 0) ? ~blBitWord(0) : ((blBitWord(1) << (numberOfBits % blBitsPerWord)) - 1);
+    }
+
+    template<typename blOtherDerivedType,typename blWordOperationType>
+    blDerivedType&                                          applyWordOperation(const blBitArrayBase<blOtherDerivedType>& bitArray,
+                                                                               blWordOperationType wordOperation);
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+template<typename blOtherDerivedType>
+inline bool blBitArrayBase<blDerivedType>::operator==(const blBitArrayBase<blOtherDerivedType>& bitArray)const
+{
+    if(size() != bitArray.size())
+        return false;
+
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return true;
+
+    const blBitWord* words1 = getWords();
+    const blBitWord* words2 = bitArray.getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+    {
+        if(words1[i] != words2[i])
+            return false;
+    }
+
+    return (((words1[numberOfWords - 1] ^ words2[numberOfWords - 1]) & getLastWordMask(size())) == 0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline blDerivedType& blBitArrayBase<blDerivedType>::set()
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return getDerived();
+
+    blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+        words[i] = ~blBitWord(0);
+
+    words[numberOfWords - 1] |= getLastWordMask(size());
+
+    return getDerived();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline blDerivedType& blBitArrayBase<blDerivedType>::reset()
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return getDerived();
+
+    blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+        words[i] = 0;
+
+    words[numberOfWords - 1] &= ~getLastWordMask(size());
+
+    return getDerived();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline blDerivedType& blBitArrayBase<blDerivedType>::flip()
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return getDerived();
+
+    blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+        words[i] = ~words[i];
+
+    words[numberOfWords - 1] ^= getLastWordMask(size());
+
+    return getDerived();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline size_t blBitArrayBase<blDerivedType>::count()const
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return 0;
+
+    const blBitWord* words = getWords();
+
+    size_t numberOfSetBits = 0;
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+        numberOfSetBits += blPopCount(words[i]);
+
+    return numberOfSetBits + blPopCount(words[numberOfWords - 1] & getLastWordMask(size()));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline bool blBitArrayBase<blDerivedType>::any()const
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return false;
+
+    const blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+    {
+        if(words[i] != 0)
+            return true;
+    }
+
+    return ((words[numberOfWords - 1] & getLastWordMask(size())) != 0);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline bool blBitArrayBase<blDerivedType>::all()const
+{
+    size_t numberOfWords = getNumberOfWords();
+
+    if(numberOfWords == 0)
+        return true;
+
+    const blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords - 1; ++i)
+    {
+        if(words[i] != ~blBitWord(0))
+            return false;
+    }
+
+    blBitWord lastWordMask = getLastWordMask(size());
+
+    return ((words[numberOfWords - 1] & lastWordMask) == lastWordMask);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline size_t blBitArrayBase<blDerivedType>::find_first()const
+{
+    size_t numberOfWords = getNumberOfWords();
+    const blBitWord* words = getWords();
+
+    for(size_t i = 0; i < numberOfWords; ++i)
+    {
+        if(words[i] != 0)
+            return std::min(i * blBitsPerWord + blCountTrailingZeros(words[i]),size());
+    }
+
+    return size();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+inline size_t blBitArrayBase<blDerivedType>::find_next(const size_t& bitIndex)const
+{
+    size_t firstBitIndex = bitIndex + 1;
+
+    if(firstBitIndex >= size())
+        return size();
+
+    size_t numberOfWords = getNumberOfWords();
+    const blBitWord* words = getWords();
+
+    // The first word is masked
+    // to skip the bits up to
+    // and including "bitIndex"
+
+    size_t wordIndex = firstBitIndex / blBitsPerWord;
+    blBitWord word = words[wordIndex] & (~blBitWord(0) << (firstBitIndex % blBitsPerWord));
+
+    while(word == 0)
+    {
+        ++wordIndex;
+
+        if(wordIndex >= numberOfWords)
+            return size();
+
+        word = words[wordIndex];
+    }
+
+    return std::min(wordIndex * blBitsPerWord + blCountTrailingZeros(word),size());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+template<typename blOtherDerivedType,typename blWordOperationType>
+inline blDerivedType& blBitArrayBase<blDerivedType>::applyWordOperation(const blBitArrayBase<blOtherDerivedType>& bitArray,
+                                                                         blWordOperationType wordOperation)
+{
+    // Only the bits both
+    // arrays have are used,
+    // the last shared word
+    // is masked
+
+    size_t numberOfBits = std::min(size(),bitArray.size());
+    size_t numberOfFullWords = numberOfBits / blBitsPerWord;
+
+    blBitWord* words1 = getWords();
+    const blBitWord* words2 = bitArray.getWords();
+
+    for(size_t i = 0; i < numberOfFullWords; ++i)
+        words1[i] = wordOperation(words1[i],words2[i]);
+
+    if(numberOfBits % blBitsPerWord != 0)
+    {
+        blBitWord mask = getLastWordMask(numberOfBits);
+
+        words1[numberOfFullWords] = (words1[numberOfFullWords] & ~mask) |
+                                    (wordOperation(words1[numberOfFullWords],words2[numberOfFullWords]) & mask);
+    }
+
+    return getDerived();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Bit array with a static number
+// of bits, storing its words in
+// itself (all bits start cleared)
+//-------------------------------------------------------------------
+template<size_t blNumberOfBits>
+
+class blBitArray : public blBitArrayBase< blBitArray<blNumberOfBits> >
+{
+    static_assert(blNumberOfBits > 0,"blBitArray needs at least one bit");
+
+public: // Public typedefs
+
+    static const size_t                                     blNumberOfWords = (blNumberOfBits + blBitsPerWord - 1) / blBitsPerWord;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blBitArray() : m_words()
+    {
+    }
+
+    // Initializer-list constructor
+
+    blBitArray(std::initializer_list<bool> theList) : m_words()
+    {
+        size_t bitIndex = 0;
+
+        for(auto iter = theList.begin();
+            iter != theList.end() && bitIndex < blNumberOfBits;
+            ++iter,++bitIndex)
+        {
+            this->set(bitIndex,*iter);
+        }
+    }
+
+    ~blBitArray()
+    {
+    }
+
+public: // Public functions
+
+    size_t                                                  size()const{return blNumberOfBits;}
+
+    blBitWord*                                              getWords(){return &m_words[0];}
+    const blBitWord*                                        getWords()const{return &m_words[0];}
+
+private: // Private variables
+
+    // The words
+
+    blBitWord                                               m_words[blNumberOfWords];
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Bitwise operators on static
+// bit arrays of the same size
+//-------------------------------------------------------------------
+template<size_t blNumberOfBits>
+inline blBitArray<blNumberOfBits> operator&(blBitArray<blNumberOfBits> bitArray1,
+                                            const blBitArray<blNumberOfBits>& bitArray2)
+{
+    return (bitArray1 &= bitArray2);
+}
+
+template<size_t blNumberOfBits>
+inline blBitArray<blNumberOfBits> operator|(blBitArray<blNumberOfBits> bitArray1,
+                                            const blBitArray<blNumberOfBits>& bitArray2)
+{
+    return (bitArray1 |= bitArray2);
+}
+
+template<size_t blNumberOfBits>
+inline blBitArray<blNumberOfBits> operator^(blBitArray<blNumberOfBits> bitArray1,
+                                            const blBitArray<blNumberOfBits>& bitArray2)
+{
+    return (bitArray1 ^= bitArray2);
+}
+
+template<size_t blNumberOfBits>
+inline blBitArray<blNumberOfBits> operator~(blBitArray<blNumberOfBits> bitArray)
+{
+    return bitArray.flip();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Wrapper of existing words holding
+// a run time number of bits, it does
+// not own (nor delete) the words
+//-------------------------------------------------------------------
+class blRawBitArrayWrapper : public blBitArrayBase<blRawBitArrayWrapper>
+{
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blRawBitArrayWrapper() : m_words(nullptr),m_size(0)
+    {
+    }
+
+    // Constructor using
+    // a raw static array
+    // of words (every bit
+    // is used)
+
+    template<size_t blNumberOfWords>
+    blRawBitArrayWrapper(blBitWord (&rawStaticArray)[blNumberOfWords])
+                         : m_words(&rawStaticArray[0]),
+                           m_size(blNumberOfWords * blBitsPerWord)
+    {
+    }
+
+    // Constructor using
+    // a raw array of words
+
+    blRawBitArrayWrapper(blBitWord* words,
+                         const size_t& numberOfBits)
+                         : m_words(words),
+                           m_size(numberOfBits)
+    {
+    }
+
+    ~blRawBitArrayWrapper()
+    {
+    }
+
+public: // Public functions
+
+    size_t                                                  size()const{return m_size;}
+
+    blBitWord*                                              getWords(){return m_words;}
+    const blBitWord*                                        getWords()const{return m_words;}
+
+private: // Private variables
+
+    // The wrapped words
+    // and the number of
+    // bits they hold
+
+    blBitWord*                                              m_words;
+    size_t                                                  m_size;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to easily create
+// bit array wrappers
+//-------------------------------------------------------------------
+template<size_t blNumberOfWords>
+inline blRawBitArrayWrapper getRawBitArrayWrapper(blBitWord (&rawStaticArray)[blNumberOfWords])
+{
+    return blRawBitArrayWrapper(rawStaticArray);
+}
+
+inline blRawBitArrayWrapper getRawBitArrayWrapper(blBitWord* words,
+                                                  const size_t& numberOfBits)
+{
+    return blRawBitArrayWrapper(words,
+                                numberOfBits);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_BITARRAY_HPP
@@ -0,0 +1,150 @@
+#ifndef BL_BORROWGUARD_HPP
+#define BL_BORROWGUARD_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blBorrowGuard.hpp
+// CLASS:           blBorrowGuard
+// BASE CLASS:      None
+//
+// PURPOSE:         Used to create "borrowed" smart iterators.
+//
+//                  A blIterator normally shares ownership of its
+//                  container through a std::shared_ptr, so every
+//                  iterator created or copied increments and
+//                  decrements the same atomic reference count.
+//                  When many threads iterate over one shared
+//                  container, that reference count becomes a
+//                  single cache line that all of them fight over.
+//
+//                  A borrowed iterator only keeps a raw pointer
+//                  to its container, so creating and copying it
+//                  never touches a shared atomic.  The container's
+//                  lifetime is instead guaranteed by a blBorrowGuard,
+//                  which holds one std::shared_ptr to the container
+//                  for as long as the guard is in scope.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - std::shared_ptr
+//
+// NOTES:           - Borrowed iterators must not outlive the
+//                    guard they were created from (or whatever
+//                    else keeps their container alive)
+//
+//                  - A guard can be taken once per worker thread,
+//                    or once by the thread that spawns and joins
+//                    the workers, in which case the workers never
+//                    touch the reference count at all
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Tag used to construct a borrowed
+// iterator from a container:
+//
+// blLinearIterator<myContainerType> iter(myContainer,blBorrow);
+//-------------------------------------------------------------------
+struct blBorrowTag
+{
+};
+
+const blBorrowTag                                           blBorrow = blBorrowTag();
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType>
+
+class blBorrowGuard
+{
+public: // Public typedefs
+
+    typedef std::shared_ptr<blContainerType>                blContainerPtr;
+
+public: // Constructors and destructors
+
+    // Constructor from the
+    // shared pointer of the
+    // container to keep alive
+
+    blBorrowGuard(const blContainerPtr& containerPtr) : m_containerPtr(containerPtr)
+    {
+    }
+
+    // Move constructor
+
+    blBorrowGuard(blBorrowGuard<blContainerType>&& borrowGuard) = default;
+
+    // A guard is meant to be
+    // taken once per scope,
+    // so it cannot be copied
+
+    blBorrowGuard(const blBorrowGuard<blContainerType>& borrowGuard) = delete;
+
+    // Destructor
+
+    ~blBorrowGuard()
+    {
+    }
+
+public: // Assignment operators
+
+    blBorrowGuard<blContainerType>&                         operator=(const blBorrowGuard<blContainerType>& borrowGuard) = delete;
+
+public: // Public functions
+
+    // Function used to
+    // create a borrowed
+    // iterator of the
+    // specified type, for
+    // example:
+    //
+    // auto iter = guard.getIterator< blLinearIterator<myContainerType> >();
+
+    template<typename blIteratorType>
+    blIteratorType                                          getIterator()const
+    {
+        return blIteratorType(*m_containerPtr,blBorrow);
+    }
+
+    // Functions used to
+    // get the guarded
+    // container
+
+    blContainerType&                                        getContainer()const{return (*m_containerPtr);}
+    const blContainerPtr&                                   getContainerPtr()const{return m_containerPtr;}
+
+private: // Private variables
+
+    // The shared pointer
+    // keeping the container
+    // alive
+
+    blContainerPtr                                          m_containerPtr;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to easily create
+// a borrow guard
+//-------------------------------------------------------------------
+template<typename blContainerType>
+inline blBorrowGuard<blContainerType> getBorrowGuard(const std::shared_ptr<blContainerType>& containerPtr)
+{
+    return blBorrowGuard<blContainerType>(containerPtr);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_BORROWGUARD_HPP
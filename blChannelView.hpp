@@ -0,0 +1,761 @@
+#ifndef BL_CHANNELVIEW_HPP
+#define BL_CHANNELVIEW_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blChannelView.hpp
+// CLASS:           blStridedIterator
+//                  blChannelView
+// BASE CLASS:      None
+//
+// PURPOSE:         Tools for buffers of interleaved channels (audio
+//                  frames, IMU samples and such), where frame "f"
+//                  of channel "c" out of "C" channels is element
+//                  (f * C + c):
+//
+//                  - blChannelView -- A view of a single channel of
+//                                     an interleaved buffer, whose
+//                                     iterators stride over the
+//                                     other channels, so a channel
+//                                     can be walked by the smart
+//                                     iterators like any container
+//
+//                  - blDeinterleave -- Copies an interleaved buffer
+//                                      into one buffer per channel
+//
+//                  - blInterleave -- Copies one buffer per channel
+//                                    into an interleaved buffer
+//
+//                  With SSE2, 2, 4 and 8 channels of 16-bit and
+//                  32-bit elements (int16, int32, float) are
+//                  (de)interleaved with vector shuffles, a few
+//                  frames at a time.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blArray
+//                  - blRawArrayWrapper
+//                  - emmintrin.h -- SSE2 intrinsics (when available)
+//
+// NOTES:           - Every other channel count or element type
+//                    is (de)interleaved with plain loops
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Random access iterator skipping
+// a fixed number of elements at
+// every step
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blStridedIterator : public std::iterator<std::random_access_iterator_tag,
+                                               typename std::remove_const<blDataType>::type,
+                                               ptrdiff_t,
+                                               blDataType*,
+                                               blDataType&>
+{
+public:
+
+    blStridedIterator(blDataType* ptr = nullptr,
+                      const ptrdiff_t& stride = 1)
+                      : m_ptr(ptr),
+                        m_stride(stride)
+    {
+    }
+
+    blStridedIterator(const blStridedIterator<blDataType>& iterator) = default;
+    ~blStridedIterator(){}
+
+    // Conversion from an iterator
+    // to non-const data into an
+    // iterator to const data
+
+    template<typename blOtherDataType,
+             typename = typename std::enable_if<std::is_convertible<blOtherDataType*,blDataType*>::value>::type>
+    blStridedIterator(const blStridedIterator<blOtherDataType>& iterator)
+                      : m_ptr(iterator.getPtr()),
+                        m_stride(iterator.getStride())
+    {
+    }
+
+    blStridedIterator<blDataType>&              operator=(const blStridedIterator<blDataType>& iterator) = default;
+
+    bool                                        operator==(const blStridedIterator<blDataType>& iterator)const{return (m_ptr == iterator.getPtr());}
+    bool                                        operator!=(const blStridedIterator<blDataType>& iterator)const{return (m_ptr != iterator.getPtr());}
+    bool                                        operator<(const blStridedIterator<blDataType>& iterator)const{return ((*this) - iterator < 0);}
+    bool                                        operator>(const blStridedIterator<blDataType>& iterator)const{return ((*this) - iterator > 0);}
+    bool                                        operator<=(const blStridedIterator<blDataType>& iterator)const{return ((*this) - iterator <= 0);}
+    bool                                        operator>=(const blStridedIterator<blDataType>& iterator)const{return ((*this) - iterator >= 0);}
+
+    blStridedIterator<blDataType>&              operator+=(const ptrdiff_t& movement){m_ptr += movement * m_stride;return (*this);}
+    blStridedIterator<blDataType>&              operator-=(const ptrdiff_t& movement){m_ptr -= movement * m_stride;return (*this);}
+    blStridedIterator<blDataType>&              operator++(){m_ptr += m_stride;return (*this);}
+    blStridedIterator<blDataType>&              operator--(){m_ptr -= m_stride;return (*this);}
+    blStridedIterator<blDataType>               operator++(int){auto temp(*this);m_ptr += m_stride;return temp;}
+    blStridedIterator<blDataType>               operator--(int){auto temp(*this);m_ptr -= m_stride;return temp;}
+    blStridedIterator<blDataType>               operator+(const ptrdiff_t& movement)const{auto temp(*this);temp += movement;return temp;}
+    blStridedIterator<blDataType>               operator-(const ptrdiff_t& movement)const{auto temp(*this);temp -= movement;return temp;}
+
+    ptrdiff_t                                   operator-(const blStridedIterator<blDataType>& iterator)const{return (m_ptr - iterator.getPtr()) / m_stride;}
+
+    blDataType&                                 operator*()const{return (*m_ptr);}
+    blDataType*                                 operator->()const{return m_ptr;}
+    blDataType&                                 operator[](const ptrdiff_t& offset)const{return m_ptr[offset * m_stride];}
+
+    blDataType*                                 getPtr()const{return m_ptr;}
+    ptrdiff_t                                   getStride()const{return m_stride;}
+
+private:
+
+    blDataType*                                 m_ptr;
+    ptrdiff_t                                   m_stride;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// View of one channel of an
+// interleaved buffer, it does not
+// own (nor delete) the buffer
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blChannelView
+{
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    typedef blStridedIterator<blDataType>                   iterator;
+    typedef blStridedIterator<const blDataType>             const_iterator;
+
+    typedef std::reverse_iterator<iterator>                 reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>           const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blChannelView() : m_interleaved(nullptr),m_numberOfFrames(0),m_numberOfChannels(1),m_channel(0)
+    {
+    }
+
+    // Constructor using a
+    // raw interleaved buffer
+
+    blChannelView(blDataType* interleaved,
+                  const size_t& numberOfFrames,
+                  const size_t& numberOfChannels,
+                  const size_t& channel)
+                  : m_interleaved(interleaved),
+                    m_numberOfFrames(numberOfFrames),
+                    m_numberOfChannels(numberOfChannels),
+                    m_channel(channel)
+    {
+    }
+
+    // Constructor using a wrapped
+    // interleaved buffer, the
+    // incomplete last frame (if
+    // any) is left out
+
+    blChannelView(blRawArrayWrapper<blDataType> interleaved,
+                  const size_t& numberOfChannels,
+                  const size_t& channel)
+                  : m_interleaved(interleaved.begin().getPtr()),
+                    m_numberOfFrames(interleaved.size() / numberOfChannels),
+                    m_numberOfChannels(numberOfChannels),
+                    m_channel(channel)
+    {
+    }
+
+    ~blChannelView()
+    {
+    }
+
+public: // Public functions
+
+    // Element access
+    // functions (by frame)
+
+    blDataType&                                             operator[](const size_t frameIndex){return m_interleaved[frameIndex * m_numberOfChannels + m_channel];}
+    const blDataType&                                       operator[](const size_t frameIndex)const{return m_interleaved[frameIndex * m_numberOfChannels + m_channel];}
+
+    // Functions used
+    // to return the
+    // number of frames
+
+    size_t                                                  length()const{return m_numberOfFrames;}
+    size_t                                                  size()const{return m_numberOfFrames;}
+    size_t                                                  max_size()const{return m_numberOfFrames;}
+    bool                                                    empty()const{return (m_numberOfFrames == 0);}
+
+    // Functions used to
+    // get the channel and
+    // the buffer's layout
+
+    size_t                                                  getChannel()const{return m_channel;}
+    size_t                                                  getNumberOfChannels()const{return m_numberOfChannels;}
+    blDataType*                                             getInterleaved()const{return m_interleaved;}
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(m_interleaved + m_channel,static_cast<ptrdiff_t>(m_numberOfChannels));}
+    iterator                                                end(){return begin() + static_cast<ptrdiff_t>(m_numberOfFrames);}
+    const_iterator                                          cbegin()const{return const_iterator(m_interleaved + m_channel,static_cast<ptrdiff_t>(m_numberOfChannels));}
+    const_iterator                                          cend()const{return cbegin() + static_cast<ptrdiff_t>(m_numberOfFrames);}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(end());}
+    reverse_iterator                                        rend(){return reverse_iterator(begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(cbegin());}
+
+private: // Private variables
+
+    // The interleaved buffer
+    // and its layout
+
+    blDataType*                                             m_interleaved;
+    size_t                                                  m_numberOfFrames;
+    size_t                                                  m_numberOfChannels;
+    size_t                                                  m_channel;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to easily get the
+// view of a channel of a wrapped
+// interleaved buffer
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blChannelView<blDataType> getChannelView(blRawArrayWrapper<blDataType> interleaved,
+                                                const size_t& numberOfChannels,
+                                                const size_t& channel)
+{
+    return blChannelView<blDataType>(interleaved,numberOfChannels,channel);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The plain loops
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blDeinterleaveFrames(const blDataType* interleaved,
+                                 const size_t& firstFrame,
+                                 const size_t& numberOfFrames,
+                                 const size_t& numberOfChannels,
+                                 blDataType* const* channels)
+{
+    for(size_t frame = firstFrame; frame < numberOfFrames; ++frame)
+    {
+        for(size_t channel = 0; channel < numberOfChannels; ++channel)
+            channels[channel][frame] = interleaved[frame * numberOfChannels + channel];
+    }
+}
+
+template<typename blDataType>
+inline void blInterleaveFrames(const blDataType* const* channels,
+                               const size_t& firstFrame,
+                               const size_t& numberOfFrames,
+                               const size_t& numberOfChannels,
+                               blDataType* interleaved)
+{
+    for(size_t frame = firstFrame; frame < numberOfFrames; ++frame)
+    {
+        for(size_t channel = 0; channel < numberOfChannels; ++channel)
+            interleaved[frame * numberOfChannels + channel] = channels[channel][frame];
+    }
+}
+//-------------------------------------------------------------------
+
+
+#if defined(__SSE2__)
+
+
+//-------------------------------------------------------------------
+// Vector transposes used by the
+// SSE2 kernels, they transpose
+// in place the rows (registers)
+// of 4x4 32-bit and 8x8 16-bit
+// blocks
+//-------------------------------------------------------------------
+inline void blTranspose4x32(__m128i& row0,__m128i& row1,__m128i& row2,__m128i& row3)
+{
+    __m128i temp0 = _mm_unpacklo_epi32(row0,row1);
+    __m128i temp1 = _mm_unpackhi_epi32(row0,row1);
+    __m128i temp2 = _mm_unpacklo_epi32(row2,row3);
+    __m128i temp3 = _mm_unpackhi_epi32(row2,row3);
+
+    row0 = _mm_unpacklo_epi64(temp0,temp2);
+    row1 = _mm_unpackhi_epi64(temp0,temp2);
+    row2 = _mm_unpacklo_epi64(temp1,temp3);
+    row3 = _mm_unpackhi_epi64(temp1,temp3);
+}
+
+inline void blTranspose8x16(__m128i* rows)
+{
+    __m128i temp0[8];
+    __m128i temp1[8];
+
+    for(int i = 0; i < 4; ++i)
+    {
+        temp0[2 * i] = _mm_unpacklo_epi16(rows[2 * i],rows[2 * i + 1]);
+        temp0[2 * i + 1] = _mm_unpackhi_epi16(rows[2 * i],rows[2 * i + 1]);
+    }
+
+    for(int i = 0; i < 2; ++i)
+    {
+        temp1[4 * i] = _mm_unpacklo_epi32(temp0[4 * i],temp0[4 * i + 2]);
+        temp1[4 * i + 1] = _mm_unpackhi_epi32(temp0[4 * i],temp0[4 * i + 2]);
+        temp1[4 * i + 2] = _mm_unpacklo_epi32(temp0[4 * i + 1],temp0[4 * i + 3]);
+        temp1[4 * i + 3] = _mm_unpackhi_epi32(temp0[4 * i + 1],temp0[4 * i + 3]);
+    }
+
+    for(int i = 0; i < 4; ++i)
+    {
+        rows[2 * i] = _mm_unpacklo_epi64(temp1[i],temp1[i + 4]);
+        rows[2 * i + 1] = _mm_unpackhi_epi64(temp1[i],temp1[i + 4]);
+    }
+}
+
+inline __m128i blLoad128(const void* ptr){return _mm_loadu_si128(static_cast<const __m128i*>(ptr));}
+inline void blStore128(void* ptr,const __m128i& values){_mm_storeu_si128(static_cast<__m128i*>(ptr),values);}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The SSE2 deinterleave kernels, they
+// return how many frames they copied
+// (the rest is left to the plain loops)
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline size_t blDeinterleaveSSE2(const blDataType* interleaved,
+                                 const size_t& numberOfFrames,
+                                 const size_t& numberOfChannels,
+                                 blDataType* const* channels,
+                                 std::integral_constant<size_t,4>)
+{
+    size_t frame = 0;
+
+    switch(numberOfChannels)
+    {
+    case 2:
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128 frames0 = _mm_castsi128_ps(blLoad128(interleaved + 2 * frame));
+            __m128 frames1 = _mm_castsi128_ps(blLoad128(interleaved + 2 * frame + 4));
+
+            blStore128(channels[0] + frame,_mm_castps_si128(_mm_shuffle_ps(frames0,frames1,_MM_SHUFFLE(2,0,2,0))));
+            blStore128(channels[1] + frame,_mm_castps_si128(_mm_shuffle_ps(frames0,frames1,_MM_SHUFFLE(3,1,3,1))));
+        }
+
+        break;
+
+    case 4:
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128i rows[4];
+
+            for(int i = 0; i < 4; ++i)
+                rows[i] = blLoad128(interleaved + 4 * (frame + i));
+
+            blTranspose4x32(rows[0],rows[1],rows[2],rows[3]);
+
+            for(int i = 0; i < 4; ++i)
+                blStore128(channels[i] + frame,rows[i]);
+        }
+
+        break;
+
+    case 8:
+
+        // Each frame is two vectors, the
+        // first and last four channels
+        // are transposed separately
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128i rows[8];
+
+            for(int i = 0; i < 4; ++i)
+            {
+                rows[i] = blLoad128(interleaved + 8 * (frame + i));
+                rows[i + 4] = blLoad128(interleaved + 8 * (frame + i) + 4);
+            }
+
+            blTranspose4x32(rows[0],rows[1],rows[2],rows[3]);
+            blTranspose4x32(rows[4],rows[5],rows[6],rows[7]);
+
+            for(int i = 0; i < 8; ++i)
+                blStore128(channels[i] + frame,rows[i]);
+        }
+
+        break;
+    }
+
+    return frame;
+}
+
+template<typename blDataType>
+inline size_t blDeinterleaveSSE2(const blDataType* interleaved,
+                                 const size_t& numberOfFrames,
+                                 const size_t& numberOfChannels,
+                                 blDataType* const* channels,
+                                 std::integral_constant<size_t,2>)
+{
+    size_t frame = 0;
+
+    switch(numberOfChannels)
+    {
+    case 2:
+
+        // Even and odd elements are
+        // split by sign-extending them
+        // to 32 bits and packing them
+        // back (which never saturates)
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i frames0 = blLoad128(interleaved + 2 * frame);
+            __m128i frames1 = blLoad128(interleaved + 2 * frame + 8);
+
+            blStore128(channels[0] + frame,_mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(frames0,16),16),
+                                                           _mm_srai_epi32(_mm_slli_epi32(frames1,16),16)));
+
+            blStore128(channels[1] + frame,_mm_packs_epi32(_mm_srai_epi32(frames0,16),
+                                                           _mm_srai_epi32(frames1,16)));
+        }
+
+        break;
+
+    case 4:
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i frames0 = blLoad128(interleaved + 4 * frame);
+            __m128i frames1 = blLoad128(interleaved + 4 * frame + 8);
+            __m128i frames2 = blLoad128(interleaved + 4 * frame + 16);
+            __m128i frames3 = blLoad128(interleaved + 4 * frame + 24);
+
+            __m128i temp0 = _mm_unpacklo_epi16(frames0,frames1);
+            __m128i temp1 = _mm_unpackhi_epi16(frames0,frames1);
+            __m128i temp2 = _mm_unpacklo_epi16(frames2,frames3);
+            __m128i temp3 = _mm_unpackhi_epi16(frames2,frames3);
+
+            __m128i channels01Low = _mm_unpacklo_epi16(temp0,temp1);
+            __m128i channels23Low = _mm_unpackhi_epi16(temp0,temp1);
+            __m128i channels01High = _mm_unpacklo_epi16(temp2,temp3);
+            __m128i channels23High = _mm_unpackhi_epi16(temp2,temp3);
+
+            blStore128(channels[0] + frame,_mm_unpacklo_epi64(channels01Low,channels01High));
+            blStore128(channels[1] + frame,_mm_unpackhi_epi64(channels01Low,channels01High));
+            blStore128(channels[2] + frame,_mm_unpacklo_epi64(channels23Low,channels23High));
+            blStore128(channels[3] + frame,_mm_unpackhi_epi64(channels23Low,channels23High));
+        }
+
+        break;
+
+    case 8:
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i rows[8];
+
+            for(int i = 0; i < 8; ++i)
+                rows[i] = blLoad128(interleaved + 8 * (frame + i));
+
+            blTranspose8x16(rows);
+
+            for(int i = 0; i < 8; ++i)
+                blStore128(channels[i] + frame,rows[i]);
+        }
+
+        break;
+    }
+
+    return frame;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The SSE2 interleave kernels
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline size_t blInterleaveSSE2(const blDataType* const* channels,
+                               const size_t& numberOfFrames,
+                               const size_t& numberOfChannels,
+                               blDataType* interleaved,
+                               std::integral_constant<size_t,4>)
+{
+    size_t frame = 0;
+
+    switch(numberOfChannels)
+    {
+    case 2:
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128i channel0 = blLoad128(channels[0] + frame);
+            __m128i channel1 = blLoad128(channels[1] + frame);
+
+            blStore128(interleaved + 2 * frame,_mm_unpacklo_epi32(channel0,channel1));
+            blStore128(interleaved + 2 * frame + 4,_mm_unpackhi_epi32(channel0,channel1));
+        }
+
+        break;
+
+    case 4:
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128i rows[4];
+
+            for(int i = 0; i < 4; ++i)
+                rows[i] = blLoad128(channels[i] + frame);
+
+            blTranspose4x32(rows[0],rows[1],rows[2],rows[3]);
+
+            for(int i = 0; i < 4; ++i)
+                blStore128(interleaved + 4 * (frame + i),rows[i]);
+        }
+
+        break;
+
+    case 8:
+
+        for(; frame + 4 <= numberOfFrames; frame += 4)
+        {
+            __m128i rows[8];
+
+            for(int i = 0; i < 8; ++i)
+                rows[i] = blLoad128(channels[i] + frame);
+
+            blTranspose4x32(rows[0],rows[1],rows[2],rows[3]);
+            blTranspose4x32(rows[4],rows[5],rows[6],rows[7]);
+
+            for(int i = 0; i < 4; ++i)
+            {
+                blStore128(interleaved + 8 * (frame + i),rows[i]);
+                blStore128(interleaved + 8 * (frame + i) + 4,rows[i + 4]);
+            }
+        }
+
+        break;
+    }
+
+    return frame;
+}
+
+template<typename blDataType>
+inline size_t blInterleaveSSE2(const blDataType* const* channels,
+                               const size_t& numberOfFrames,
+                               const size_t& numberOfChannels,
+                               blDataType* interleaved,
+                               std::integral_constant<size_t,2>)
+{
+    size_t frame = 0;
+
+    switch(numberOfChannels)
+    {
+    case 2:
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i channel0 = blLoad128(channels[0] + frame);
+            __m128i channel1 = blLoad128(channels[1] + frame);
+
+            blStore128(interleaved + 2 * frame,_mm_unpacklo_epi16(channel0,channel1));
+            blStore128(interleaved + 2 * frame + 8,_mm_unpackhi_epi16(channel0,channel1));
+        }
+
+        break;
+
+    case 4:
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i channel0 = blLoad128(channels[0] + frame);
+            __m128i channel1 = blLoad128(channels[1] + frame);
+            __m128i channel2 = blLoad128(channels[2] + frame);
+            __m128i channel3 = blLoad128(channels[3] + frame);
+
+            __m128i channels01Low = _mm_unpacklo_epi16(channel0,channel1);
+            __m128i channels01High = _mm_unpackhi_epi16(channel0,channel1);
+            __m128i channels23Low = _mm_unpacklo_epi16(channel2,channel3);
+            __m128i channels23High = _mm_unpackhi_epi16(channel2,channel3);
+
+            blStore128(interleaved + 4 * frame,_mm_unpacklo_epi32(channels01Low,channels23Low));
+            blStore128(interleaved + 4 * frame + 8,_mm_unpackhi_epi32(channels01Low,channels23Low));
+            blStore128(interleaved + 4 * frame + 16,_mm_unpacklo_epi32(channels01High,channels23High));
+            blStore128(interleaved + 4 * frame + 24,_mm_unpackhi_epi32(channels01High,channels23High));
+        }
+
+        break;
+
+    case 8:
+
+        for(; frame + 8 <= numberOfFrames; frame += 8)
+        {
+            __m128i rows[8];
+
+            for(int i = 0; i < 8; ++i)
+                rows[i] = blLoad128(channels[i] + frame);
+
+            blTranspose8x16(rows);
+
+            for(int i = 0; i < 8; ++i)
+                blStore128(interleaved + 8 * (frame + i),rows[i]);
+        }
+
+        break;
+    }
+
+    return frame;
+}
+//-------------------------------------------------------------------
+
+
+#endif // __SSE2__
+
+
+//-------------------------------------------------------------------
+// Other element sizes have
+// no vector kernels
+//-------------------------------------------------------------------
+template<typename blDataType,typename blElementSizeType>
+inline size_t blDeinterleaveSSE2(const blDataType*,
+                                 const size_t&,
+                                 const size_t&,
+                                 blDataType* const*,
+                                 blElementSizeType)
+{
+    return 0;
+}
+
+template<typename blDataType,typename blElementSizeType>
+inline size_t blInterleaveSSE2(const blDataType* const*,
+                               const size_t&,
+                               const size_t&,
+                               blDataType*,
+                               blElementSizeType)
+{
+    return 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The element sizes of the vector
+// kernels (0 for types which can't
+// use them)
+//-------------------------------------------------------------------
+template<typename blDataType>
+using blInterleaveElementSize = std::integral_constant<size_t,
+                                                       (std::is_arithmetic<blDataType>::value &&
+                                                        (sizeof(blDataType) == 2 || sizeof(blDataType) == 4)) ? sizeof(blDataType) : 0>;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to copy "numberOfFrames"
+// interleaved frames into one buffer
+// per channel
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blDeinterleave(const blDataType* interleaved,
+                           const size_t& numberOfFrames,
+                           const size_t& numberOfChannels,
+                           blDataType* const* channels)
+{
+    size_t firstFrame = blDeinterleaveSSE2(interleaved,
+                                           numberOfFrames,
+                                           numberOfChannels,
+                                           channels,
+                                           blInterleaveElementSize<blDataType>());
+
+    blDeinterleaveFrames(interleaved,firstFrame,numberOfFrames,numberOfChannels,channels);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to copy "numberOfFrames"
+// frames from one buffer per channel
+// into an interleaved buffer
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blInterleave(const blDataType* const* channels,
+                         const size_t& numberOfFrames,
+                         const size_t& numberOfChannels,
+                         blDataType* interleaved)
+{
+    size_t firstFrame = blInterleaveSSE2(channels,
+                                         numberOfFrames,
+                                         numberOfChannels,
+                                         interleaved,
+                                         blInterleaveElementSize<blDataType>());
+
+    blInterleaveFrames(channels,firstFrame,numberOfFrames,numberOfChannels,interleaved);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The same functions working with a
+// wrapped interleaved buffer and a
+// blArray per channel
+//
+// NOTE:    Only the frames both the
+//          buffer and the arrays
+//          have are copied
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blAlignment,size_t blNumberOfChannels>
+inline void blDeinterleave(blRawArrayWrapper<blDataType> interleaved,
+                           blArray<blDataType,blArraySize,blAlignment> (&channels)[blNumberOfChannels])
+{
+    blDataType* channelPtrs[blNumberOfChannels];
+
+    for(size_t i = 0; i < blNumberOfChannels; ++i)
+        channelPtrs[i] = channels[i].data();
+
+    blDeinterleave(static_cast<const blDataType*>(interleaved.begin().getPtr()),
+                   std::min(blArraySize,interleaved.size() / blNumberOfChannels),
+                   blNumberOfChannels,
+                   channelPtrs);
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,size_t blNumberOfChannels>
+inline void blInterleave(const blArray<blDataType,blArraySize,blAlignment> (&channels)[blNumberOfChannels],
+                         blRawArrayWrapper<blDataType> interleaved)
+{
+    const blDataType* channelPtrs[blNumberOfChannels];
+
+    for(size_t i = 0; i < blNumberOfChannels; ++i)
+        channelPtrs[i] = channels[i].data();
+
+    blInterleave(channelPtrs,
+                 std::min(blArraySize,interleaved.size() / blNumberOfChannels),
+                 blNumberOfChannels,
+                 interleaved.begin().getPtr());
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_CHANNELVIEW_HPP
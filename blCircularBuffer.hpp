@@ -0,0 +1,690 @@
+#ifndef BL_CIRCULARBUFFER_HPP
+#define BL_CIRCULARBUFFER_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blCircularBuffer.hpp
+// CLASS:           blCircularBufferIterator
+//                  blCircularBufferBase
+//                  blCircularBuffer
+//                  blDynamicCircularBuffer
+// BASE CLASS:      None
+//
+// PURPOSE:         Owning circular buffers (ring buffers), keeping
+//                  the head/tail bookkeeping in one place:
+//
+//                  - blCircularBuffer -- The capacity is a template
+//                                        parameter and the elements
+//                                        are stored in the buffer
+//                                        itself.
+//
+//                  - blDynamicCircularBuffer -- The capacity is chosen
+//                                               at run time and the
+//                                               elements are allocated
+//                                               through an allocator.
+//
+//                  Both can push elements one at a time or in bulk
+//                  (copying a span with at most two memcpy calls),
+//                  pop them, and "linearize" their contents by
+//                  rotating them in place.
+//
+//                  Their iterators walk the elements in logical
+//                  order, so a blCircularIterator over a circular
+//                  buffer starts at the buffer's oldest element.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper
+//
+// NOTES:           - What happens when pushing into a full buffer
+//                    is chosen through an overflow policy:
+//
+//                    - blOverwriteWhenFull -- The oldest elements
+//                                             are overwritten
+//                                             (the default)
+//
+//                    - blRejectWhenFull -- The new elements
+//                                          are rejected
+//
+//                  - Elements are copied with memcpy when they
+//                    are trivially copyable and with std::copy
+//                    otherwise
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The overflow policies
+//-------------------------------------------------------------------
+struct blOverwriteWhenFull
+{
+};
+
+struct blRejectWhenFull
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Random access iterator walking a
+// circular buffer in logical order,
+// from its oldest to its newest element
+//-------------------------------------------------------------------
+template<typename blDataType>
+
+class blCircularBufferIterator : public std::iterator<std::random_access_iterator_tag,
+                                                      blDataType,
+                                                      ptrdiff_t,
+                                                      blDataType*,
+                                                      blDataType&>
+{
+public:
+
+    blCircularBufferIterator(blDataType* data = nullptr,
+                             const size_t& capacity = 0,
+                             const size_t& head = 0,
+                             const ptrdiff_t& index = 0)
+                             : m_data(data),
+                               m_capacity(capacity),
+                               m_head(head),
+                               m_index(index)
+    {
+    }
+
+    blCircularBufferIterator(const blCircularBufferIterator<blDataType>& iterator) = default;
+    ~blCircularBufferIterator(){}
+
+    // Conversion from an iterator
+    // to non-const data into an
+    // iterator to const data
+
+    template<typename blOtherDataType,
+             typename = typename std::enable_if<std::is_convertible<blOtherDataType*,blDataType*>::value>::type>
+    blCircularBufferIterator(const blCircularBufferIterator<blOtherDataType>& iterator)
+                             : m_data(iterator.getData()),
+                               m_capacity(iterator.getCapacity()),
+                               m_head(iterator.getHead()),
+                               m_index(iterator.getIndex())
+    {
+    }
+
+    blCircularBufferIterator<blDataType>&       operator=(const blCircularBufferIterator<blDataType>& iterator) = default;
+
+    bool                                        operator==(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index == iterator.getIndex() && m_data == iterator.getData());}
+    bool                                        operator!=(const blCircularBufferIterator<blDataType>& iterator)const{return !((*this) == iterator);}
+    bool                                        operator<(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index < iterator.getIndex());}
+    bool                                        operator>(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index > iterator.getIndex());}
+    bool                                        operator<=(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index <= iterator.getIndex());}
+    bool                                        operator>=(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index >= iterator.getIndex());}
+
+    blCircularBufferIterator<blDataType>&       operator+=(const ptrdiff_t& movement){m_index += movement;return (*this);}
+    blCircularBufferIterator<blDataType>&       operator-=(const ptrdiff_t& movement){m_index -= movement;return (*this);}
+    blCircularBufferIterator<blDataType>&       operator++(){++m_index;return (*this);}
+    blCircularBufferIterator<blDataType>&       operator--(){--m_index;return (*this);}
+    blCircularBufferIterator<blDataType>        operator++(int){auto temp(*this);++m_index;return temp;}
+    blCircularBufferIterator<blDataType>        operator--(int){auto temp(*this);--m_index;return temp;}
+    blCircularBufferIterator<blDataType>        operator+(const ptrdiff_t& movement)const{auto temp(*this);temp.m_index += movement;return temp;}
+    blCircularBufferIterator<blDataType>        operator-(const ptrdiff_t& movement)const{auto temp(*this);temp.m_index -= movement;return temp;}
+
+    ptrdiff_t                                   operator-(const blCircularBufferIterator<blDataType>& iterator)const{return (m_index - iterator.getIndex());}
+
+    blDataType&                                 operator*()const{return m_data[getPhysicalIndex(m_index)];}
+    blDataType*                                 operator->()const{return &m_data[getPhysicalIndex(m_index)];}
+    blDataType&                                 operator[](const ptrdiff_t& offset)const{return m_data[getPhysicalIndex(m_index + offset)];}
+
+    blDataType*                                 getData()const{return m_data;}
+    size_t                                      getCapacity()const{return m_capacity;}
+    size_t                                      getHead()const{return m_head;}
+    ptrdiff_t                                   getIndex()const{return m_index;}
+
+private:
+
+    // The logical index is at most
+    // the capacity, and the head is
+    // less than the capacity, so the
+    // position wraps at most once
+
+    size_t                                      getPhysicalIndex(const ptrdiff_t& index)const
+    {
+        size_t physicalIndex = m_head + static_cast<size_t>(index);
+
+        if(physicalIndex >= m_capacity)
+            physicalIndex -= m_capacity;
+
+        return physicalIndex;
+    }
+
+    blDataType*                                 m_data;
+    size_t                                      m_capacity;
+    size_t                                      m_head;
+    ptrdiff_t                                   m_index;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The head/tail bookkeeping shared by the
+// static and dynamic circular buffers
+//
+// NOTE:    The derived buffer provides
+//          the storage through:
+//
+//          - blDataType* getStorage()
+//          - const blDataType* getStorage()const
+//          - size_t capacity()const
+//-------------------------------------------------------------------
+template<typename blDerivedType,
+         typename blDataType,
+         typename blOverflowPolicyType>
+
+class blCircularBufferBase
+{
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    typedef blCircularBufferIterator<blDataType>            iterator;
+    typedef blCircularBufferIterator<const blDataType>      const_iterator;
+
+    typedef std::reverse_iterator<iterator>                 reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>           const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    blCircularBufferBase() : m_head(0),m_size(0)
+    {
+    }
+
+    ~blCircularBufferBase()
+    {
+    }
+
+public: // Public functions
+
+    // Element access
+    // functions using
+    // logical indices
+    // (0 is the oldest
+    // element)
+
+    blDataType&                                             operator[](const size_t elementIndex){return getStorage()[getPhysicalIndex(elementIndex)];}
+    const blDataType&                                       operator[](const size_t elementIndex)const{return getStorage()[getPhysicalIndex(elementIndex)];}
+
+    blDataType&                                             front(){return getStorage()[m_head];}
+    const blDataType&                                       front()const{return getStorage()[m_head];}
+    blDataType&                                             back(){return getStorage()[getPhysicalIndex(m_size - 1)];}
+    const blDataType&                                       back()const{return getStorage()[getPhysicalIndex(m_size - 1)];}
+
+    // Functions used
+    // to return the
+    // buffer size
+
+    size_t                                                  length()const{return m_size;}
+    size_t                                                  size()const{return m_size;}
+    size_t                                                  max_size()const{return capacity();}
+    bool                                                    empty()const{return (m_size == 0);}
+    bool                                                    full()const{return (m_size == capacity());}
+
+    // Function used to
+    // empty the buffer
+
+    void                                                    clear(){m_head = 0;m_size = 0;}
+
+    // Function used to push
+    // one element, it returns
+    // false when the element
+    // was rejected
+
+    bool                                                    push_back(const blDataType& value);
+
+    // Function used to push
+    // a span of elements with
+    // at most two copies, it
+    // returns how many elements
+    // were pushed
+
+    size_t                                                  push_back(const blDataType* values,
+                                                                      const size_t& numberOfValues);
+
+    size_t                                                  push_back(const blRawArrayWrapper<const blDataType>& values){return push_back(values.size() > 0 ? &values[0] : nullptr,values.size());}
+    size_t                                                  push_back(const blRawArrayWrapper<blDataType>& values){return push_back(values.size() > 0 ? &values[0] : nullptr,values.size());}
+
+    // Functions used to pop
+    // the oldest element, they
+    // return false when the
+    // buffer is empty
+
+    bool                                                    pop_front();
+    bool                                                    pop_front(blDataType& value);
+
+    // Function used to pop
+    // up to "numberOfValues"
+    // oldest elements with at
+    // most two copies, it returns
+    // how many elements were popped
+
+    size_t                                                  pop_front(blDataType* values,
+                                                                      const size_t& numberOfValues);
+
+    // Function used to rotate
+    // the elements in place so
+    // that the oldest one is at
+    // the start of the storage,
+    // it returns the now
+    // contiguous elements
+
+    blRawArrayWrapper<blDataType>                           linearize();
+
+    // Functions used to get
+    // the elements as (at most)
+    // two contiguous segments,
+    // the second one is only
+    // non empty when the elements
+    // wrap around the storage
+
+    blRawArrayWrapper<blDataType>                           getFirstSegment();
+    blRawArrayWrapper<blDataType>                           getSecondSegment();
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(getStorage(),capacity(),m_head,0);}
+    iterator                                                end(){return iterator(getStorage(),capacity(),m_head,static_cast<ptrdiff_t>(m_size));}
+    const_iterator                                          cbegin()const{return const_iterator(getStorage(),capacity(),m_head,0);}
+    const_iterator                                          cend()const{return const_iterator(getStorage(),capacity(),m_head,static_cast<ptrdiff_t>(m_size));}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(end());}
+    reverse_iterator                                        rend(){return reverse_iterator(begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(cbegin());}
+
+protected: // Protected functions
+
+    // Function used to copy
+    // elements, with memcpy
+    // when they are trivially
+    // copyable
+
+    static void                                             copyElements(blDataType* destination,
+                                                                         const blDataType* source,
+                                                                         const size_t& numberOfElements);
+
+private: // Private functions
+
+    blDataType*                                             getStorage(){return static_cast<blDerivedType*>(this)->getStorage();}
+    const blDataType*                                       getStorage()const{return static_cast<const blDerivedType*>(this)->getStorage();}
+    size_t                                                  capacity()const{return static_cast<const blDerivedType*>(this)->capacity();}
+
+    size_t                                                  getPhysicalIndex(const size_t& index)const
+    {
+        size_t physicalIndex = m_head + index;
+
+        if(physicalIndex >= capacity())
+            physicalIndex -= capacity();
+
+        return physicalIndex;
+    }
+
+    // Functions used to handle
+    // a push into a full buffer
+
+    bool                                                    pushWhenFull(const blDataType& value,blOverwriteWhenFull);
+    bool                                                    pushWhenFull(const blDataType& value,blRejectWhenFull);
+
+    size_t                                                  getNumberOfValuesToPush(const size_t& numberOfValues,blOverwriteWhenFull)const{return numberOfValues;}
+    size_t                                                  getNumberOfValuesToPush(const size_t& numberOfValues,blRejectWhenFull)const{return std::min(numberOfValues,capacity() - m_size);}
+
+protected: // Protected variables
+
+    // The physical index of
+    // the oldest element and
+    // the number of elements
+
+    size_t                                                  m_head;
+    size_t                                                  m_size;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline void blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::copyElements(blDataType* destination,
+                                                                                              const blDataType* source,
+                                                                                              const size_t& numberOfElements)
+{
+    if(numberOfElements == 0)
+        return;
+
+    if(std::is_trivially_copyable<blDataType>::value)
+        std::memcpy(static_cast<void*>(destination),static_cast<const void*>(source),numberOfElements * sizeof(blDataType));
+    else
+        std::copy(source,source + numberOfElements,destination);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline bool blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::push_back(const blDataType& value)
+{
+    if(m_size == capacity())
+        return pushWhenFull(value,blOverflowPolicyType());
+
+    getStorage()[getPhysicalIndex(m_size)] = value;
+    ++m_size;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline bool blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::pushWhenFull(const blDataType& value,blOverwriteWhenFull)
+{
+    if(capacity() == 0)
+        return false;
+
+    // The oldest element's
+    // slot becomes the newest
+
+    getStorage()[m_head] = value;
+
+    ++m_head;
+
+    if(m_head == capacity())
+        m_head = 0;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline bool blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::pushWhenFull(const blDataType&,blRejectWhenFull)
+{
+    return false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline size_t blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::push_back(const blDataType* values,
+                                                                                             const size_t& numberOfValues)
+{
+    const size_t bufferCapacity = capacity();
+
+    size_t numberOfValuesToPush = getNumberOfValuesToPush(numberOfValues,blOverflowPolicyType());
+
+    if(numberOfValuesToPush == 0 || bufferCapacity == 0)
+        return 0;
+
+    // When overwriting with more
+    // values than the buffer can
+    // hold, only the newest ones
+    // are kept, in one copy
+
+    if(numberOfValuesToPush >= bufferCapacity)
+    {
+        copyElements(getStorage(),values + (numberOfValuesToPush - bufferCapacity),bufferCapacity);
+
+        m_head = 0;
+        m_size = bufferCapacity;
+
+        return numberOfValuesToPush;
+    }
+
+    // Otherwise the values are
+    // copied from the tail up to
+    // the end of the storage, and
+    // the rest from its start
+
+    size_t tail = getPhysicalIndex(m_size);
+
+    size_t numberOfValuesBeforeWrap = std::min(numberOfValuesToPush,bufferCapacity - tail);
+
+    copyElements(getStorage() + tail,values,numberOfValuesBeforeWrap);
+    copyElements(getStorage(),values + numberOfValuesBeforeWrap,numberOfValuesToPush - numberOfValuesBeforeWrap);
+
+    // Overwritten elements
+    // move the head forward
+
+    size_t newSize = m_size + numberOfValuesToPush;
+
+    if(newSize > bufferCapacity)
+    {
+        m_head = getPhysicalIndex(newSize - bufferCapacity);
+        newSize = bufferCapacity;
+    }
+
+    m_size = newSize;
+
+    return numberOfValuesToPush;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline bool blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::pop_front()
+{
+    if(m_size == 0)
+        return false;
+
+    ++m_head;
+
+    if(m_head == capacity())
+        m_head = 0;
+
+    --m_size;
+
+    return true;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline bool blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::pop_front(blDataType& value)
+{
+    if(m_size == 0)
+        return false;
+
+    value = getStorage()[m_head];
+
+    return pop_front();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline size_t blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::pop_front(blDataType* values,
+                                                                                             const size_t& numberOfValues)
+{
+    size_t numberOfValuesToPop = std::min(numberOfValues,m_size);
+
+    if(numberOfValuesToPop == 0)
+        return 0;
+
+    size_t numberOfValuesBeforeWrap = std::min(numberOfValuesToPop,capacity() - m_head);
+
+    copyElements(values,getStorage() + m_head,numberOfValuesBeforeWrap);
+    copyElements(values + numberOfValuesBeforeWrap,getStorage(),numberOfValuesToPop - numberOfValuesBeforeWrap);
+
+    m_head = getPhysicalIndex(numberOfValuesToPop);
+    m_size -= numberOfValuesToPop;
+
+    return numberOfValuesToPop;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline blRawArrayWrapper<blDataType> blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::linearize()
+{
+    if(m_head != 0)
+    {
+        std::rotate(getStorage(),getStorage() + m_head,getStorage() + capacity());
+
+        m_head = 0;
+    }
+
+    return blRawArrayWrapper<blDataType>(getStorage(),m_size);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline blRawArrayWrapper<blDataType> blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::getFirstSegment()
+{
+    if(m_size == 0)
+        return blRawArrayWrapper<blDataType>();
+
+    return blRawArrayWrapper<blDataType>(getStorage() + m_head,
+                                         std::min(m_size,capacity() - m_head));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDerivedType,typename blDataType,typename blOverflowPolicyType>
+inline blRawArrayWrapper<blDataType> blCircularBufferBase<blDerivedType,blDataType,blOverflowPolicyType>::getSecondSegment()
+{
+    size_t sizeOfFirstSegment = std::min(m_size,capacity() - m_head);
+
+    if(m_size <= sizeOfFirstSegment)
+        return blRawArrayWrapper<blDataType>();
+
+    return blRawArrayWrapper<blDataType>(getStorage(),
+                                         m_size - sizeOfFirstSegment);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Circular buffer with a static
+// capacity, storing its elements
+// in itself
+//-------------------------------------------------------------------
+template<typename blDataType,
+         size_t blBufferCapacity,
+         typename blOverflowPolicyType = blOverwriteWhenFull>
+
+class blCircularBuffer : public blCircularBufferBase<blCircularBuffer<blDataType,blBufferCapacity,blOverflowPolicyType>,
+                                                     blDataType,
+                                                     blOverflowPolicyType>
+{
+    static_assert(blBufferCapacity > 0,"blCircularBuffer needs a capacity of at least one element");
+
+public: // Constructors and destructors
+
+    blCircularBuffer() = default;
+
+    ~blCircularBuffer()
+    {
+    }
+
+public: // Public functions
+
+    size_t                                                  capacity()const{return blBufferCapacity;}
+
+    blDataType*                                             getStorage(){return &m_container[0];}
+    const blDataType*                                       getStorage()const{return &m_container[0];}
+
+private: // Private variables
+
+    // The storage
+
+    blDataType                                              m_container[blBufferCapacity];
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Circular buffer with a run time
+// capacity, allocating its elements
+// through an allocator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blOverflowPolicyType = blOverwriteWhenFull,
+         typename blAllocatorType = std::allocator<blDataType> >
+
+class blDynamicCircularBuffer : public blCircularBufferBase<blDynamicCircularBuffer<blDataType,blOverflowPolicyType,blAllocatorType>,
+                                                            blDataType,
+                                                            blOverflowPolicyType>
+{
+public: // Constructors and destructors
+
+    blDynamicCircularBuffer(const size_t& bufferCapacity = 0,
+                            const blAllocatorType& allocator = blAllocatorType())
+                            : m_container(bufferCapacity,blDataType(),allocator)
+    {
+    }
+
+    ~blDynamicCircularBuffer()
+    {
+    }
+
+public: // Public functions
+
+    size_t                                                  capacity()const{return m_container.size();}
+
+    blDataType*                                             getStorage(){return m_container.data();}
+    const blDataType*                                       getStorage()const{return m_container.data();}
+
+    // Function used to change
+    // the capacity, keeping the
+    // newest elements that fit
+
+    void                                                    setCapacity(const size_t& bufferCapacity);
+
+private: // Private variables
+
+    // The storage
+
+    std::vector<blDataType,blAllocatorType>                 m_container;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType,typename blAllocatorType>
+inline void blDynamicCircularBuffer<blDataType,blOverflowPolicyType,blAllocatorType>::setCapacity(const size_t& bufferCapacity)
+{
+    if(bufferCapacity == capacity())
+        return;
+
+    this->linearize();
+
+    size_t numberOfElementsToKeep = std::min(this->m_size,bufferCapacity);
+
+    std::vector<blDataType,blAllocatorType> newContainer(bufferCapacity,blDataType(),m_container.get_allocator());
+
+    std::copy(m_container.begin() + (this->m_size - numberOfElementsToKeep),
+              m_container.begin() + this->m_size,
+              newContainer.begin());
+
+    m_container.swap(newContainer);
+
+    this->m_head = 0;
+    this->m_size = numberOfElementsToKeep;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_CIRCULARBUFFER_HPP
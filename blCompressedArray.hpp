@@ -0,0 +1,783 @@
+#ifndef BL_COMPRESSEDARRAY_HPP
+#define BL_COMPRESSEDARRAY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blCompressedArray.hpp
+// CLASS:           blCompressedArrayIterator
+//                  blCompressedArray
+// BASE CLASS:      None
+//
+// PURPOSE:         A read only container of integers (timestamps,
+//                  ids, sorted sequences and such) stored delta
+//                  encoded and bit packed, decoded on the fly.
+//
+//                  The values are split into blocks (128 values
+//                  by default):
+//
+//                  - Every block keeps its first value in the
+//                    block index, the other values are stored as
+//                    the deltas from their previous value
+//
+//                  - A block's deltas are stored "frame of
+//                    reference" style, as their distance from
+//                    the block's smallest delta, packed with as
+//                    many bits as the block's biggest distance
+//                    needs (a sorted sequence with small steps
+//                    takes a few bits per value)
+//
+//                  The iterators decode one value per step, and
+//                  jump through the block index to any position,
+//                  decoding at most one block's worth of deltas,
+//                  so the container can be walked with
+//                  blLinearConstIterator like any other.
+//                  Whole blocks are decoded (by "decode") with
+//                  unpacking loops compiled for each bit width,
+//                  and cpus with AVX2 unpack widths up to 25 bits
+//                  eight values at a time (chosen at run time).
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blArrayAlgorithms -- blMakeIndexSequence
+//                  - blSimdAlgorithms -- blGetSimdLevel
+//
+// NOTES:           - Deltas are taken with wrap around arithmetic,
+//                    so any sequence of integers is stored exactly,
+//                    but only sequences with small steps compress
+//
+//                  - The iterators' "reference" is the value
+//                    itself (the values are decoded, there is
+//                    no element to point to)
+//
+//                  - lower_bound only makes sense for sequences
+//                    sorted in ascending order
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Default number of
+// values per block
+//-------------------------------------------------------------------
+const size_t                                                blCompressedArrayBlockSize = 128;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to read and write
+// values packed with "bitWidth" bits
+// each, least significant bits first
+//
+// NOTE:    Reading a value loads the 8
+//          bytes (plus one) it starts in,
+//          so the packed buffer has to be
+//          padded with (at least) 9 bytes
+//-------------------------------------------------------------------
+inline uint64_t blLoadLittleEndian64(const uint8_t* bytes)
+{
+    return  uint64_t(bytes[0])        | (uint64_t(bytes[1]) << 8)  |
+           (uint64_t(bytes[2]) << 16) | (uint64_t(bytes[3]) << 24) |
+           (uint64_t(bytes[4]) << 32) | (uint64_t(bytes[5]) << 40) |
+           (uint64_t(bytes[6]) << 48) | (uint64_t(bytes[7]) << 56);
+}
+
+inline uint64_t blGetPackedValue(const uint8_t* packed,
+                                 const size_t& index,
+                                 const unsigned& bitWidth)
+{
+    if(bitWidth == 0)
+        return 0;
+
+    size_t bit = index * bitWidth;
+    unsigned shift = static_cast<unsigned>(bit & 7);
+
+    uint64_t value = blLoadLittleEndian64(packed + (bit >> 3)) >> shift;
+
+    if(bitWidth + shift > 64)
+        value |= uint64_t(packed[(bit >> 3) + 8]) << (64 - shift);
+
+    return (bitWidth == 64 ? value : value & ((uint64_t(1) << bitWidth) - 1));
+}
+
+inline void blSetPackedValue(uint8_t* packed,
+                             const size_t& index,
+                             const unsigned& bitWidth,
+                             const uint64_t& value)
+{
+    size_t bit = index * bitWidth;
+
+    for(unsigned i = 0; i < bitWidth;)
+    {
+        unsigned offset = static_cast<unsigned>((bit + i) & 7);
+        unsigned numberOfBits = std::min(8 - offset,bitWidth - i);
+
+        packed[(bit + i) >> 3] |= static_cast<uint8_t>(((value >> i) & ((1u << numberOfBits) - 1)) << offset);
+
+        i += numberOfBits;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to unpack a whole block,
+// compiled once per bit width so that
+// every shift and mask is a constant
+//-------------------------------------------------------------------
+typedef void (*blUnpackFunction)(const uint8_t* packed,const size_t& numberOfValues,uint64_t* values);
+
+template<size_t blBitWidth>
+inline void blUnpackValues(const uint8_t* packed,
+                           const size_t& numberOfValues,
+                           uint64_t* values)
+{
+    for(size_t i = 0; i < numberOfValues; ++i)
+        values[i] = blGetPackedValue(packed,i,blBitWidth);
+}
+//-------------------------------------------------------------------
+
+
+#if defined(BL_SIMD_ENABLED)
+
+
+//-------------------------------------------------------------------
+// The AVX2 unpacking of bit widths up
+// to 25, eight values at a time
+//
+// NOTE:    - Eight values take "bitWidth"
+//            bytes, so every group starts
+//            on a byte, and the bytes of
+//            its first and last four values
+//            are loaded in the two halves
+//            of a vector
+//
+//          - Each value's (up to) four bytes
+//            are shuffled into its own 32-bit
+//            lane, then shifted and masked
+//            (its bits plus its shift fit in
+//            32 bits up to 25 bits per value)
+//
+//          - The loads read up to 16 bytes
+//            past a group's start, which the
+//            packed buffer's padding covers
+//-------------------------------------------------------------------
+const size_t                                                blMaxVectorUnpackBitWidth = 25;
+
+// The byte each byte of the
+// shuffled vector comes from,
+// and each lane's shift
+
+constexpr int blUnpackShuffleIndex(const size_t bitWidth,
+                                   const size_t byte)
+{
+    return static_cast<int>(((((byte % 16) / 4 + 4 * (byte / 16)) * bitWidth) >> 3) - (byte / 16) * ((4 * bitWidth) >> 3) + byte % 4);
+}
+
+constexpr int blUnpackShift(const size_t bitWidth,
+                            const size_t lane)
+{
+    return static_cast<int>((lane * bitWidth) & 7);
+}
+
+template<size_t blBitWidth,size_t... blBytes>
+__attribute__((target("avx2"))) inline __m256i blGetUnpackShuffle(blIndexSequence<blBytes...>)
+{
+    return _mm256_setr_epi8(static_cast<char>(blUnpackShuffleIndex(blBitWidth,blBytes))...);
+}
+
+template<size_t blBitWidth,size_t... blLanes>
+__attribute__((target("avx2"))) inline __m256i blGetUnpackShifts(blIndexSequence<blLanes...>)
+{
+    return _mm256_setr_epi32(blUnpackShift(blBitWidth,blLanes)...);
+}
+
+template<size_t blBitWidth>
+__attribute__((target("avx2"))) void blUnpackValuesAVX2(const uint8_t* packed,
+                                                        const size_t& numberOfValues,
+                                                        uint64_t* values)
+{
+    const __m256i shuffle = blGetUnpackShuffle<blBitWidth>(blMakeIndexSequence<32>());
+    const __m256i shifts = blGetUnpackShifts<blBitWidth>(blMakeIndexSequence<8>());
+    const __m256i mask = _mm256_set1_epi32(static_cast<int>((uint32_t(1) << blBitWidth) - 1));
+
+    size_t i = 0;
+
+    for(; i + 8 <= numberOfValues; i += 8)
+    {
+        const uint8_t* group = packed + (i * blBitWidth) / 8;
+
+        __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))),
+                                                _mm_loadu_si128(reinterpret_cast<const __m128i*>(group + ((4 * blBitWidth) >> 3))),
+                                                1);
+
+        __m256i unpacked = _mm256_and_si256(_mm256_srlv_epi32(_mm256_shuffle_epi8(bytes,shuffle),shifts),mask);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i),_mm256_cvtepu32_epi64(_mm256_castsi256_si128(unpacked)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i + 4),_mm256_cvtepu32_epi64(_mm256_extracti128_si256(unpacked,1)));
+    }
+
+    for(; i < numberOfValues; ++i)
+        values[i] = blGetPackedValue(packed,i,blBitWidth);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SIMD_ENABLED
+
+
+//-------------------------------------------------------------------
+// Functions used to get the unpacking
+// function of a bit width, choosing
+// the AVX2 one when the cpu has it
+//-------------------------------------------------------------------
+template<size_t... blBitWidths>
+inline blUnpackFunction blGetUnpackFunction(const unsigned& bitWidth,
+                                            blIndexSequence<blBitWidths...>)
+{
+    static const blUnpackFunction unpackFunctions[] = {&blUnpackValues<blBitWidths>...};
+
+    return unpackFunctions[bitWidth];
+}
+
+#if defined(BL_SIMD_ENABLED)
+
+template<size_t... blBitWidths>
+inline blUnpackFunction blGetVectorUnpackFunction(const unsigned& bitWidth,
+                                                  blIndexSequence<blBitWidths...>)
+{
+    static const blUnpackFunction unpackFunctions[] = {&blUnpackValuesAVX2<blBitWidths>...};
+
+    return unpackFunctions[bitWidth];
+}
+
+#endif
+
+inline blUnpackFunction blGetUnpackFunction(const unsigned& bitWidth)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        if(bitWidth <= blMaxVectorUnpackBitWidth && blGetSimdLevel() >= blSimdAVX2)
+            return blGetVectorUnpackFunction(bitWidth,blMakeIndexSequence<blMaxVectorUnpackBitWidth + 1>());
+
+    #endif
+
+    return blGetUnpackFunction(bitWidth,blMakeIndexSequence<65>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The index entry of a block
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blCompressedBlock
+{
+    typedef typename std::make_unsigned<blDataType>::type   blUnsignedType;
+
+    // The block's first value,
+    // its smallest delta (biased
+    // so that it compares as an
+    // unsigned integer), where
+    // its deltas start in the
+    // packed buffer and the
+    // bits per delta
+
+    blDataType                                              m_firstValue;
+    blUnsignedType                                          m_minDelta;
+    size_t                                                  m_byteOffset;
+    unsigned                                                m_bitWidth;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Forward declaration
+// of the container
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+class blCompressedArray;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The decoding iterator
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+
+class blCompressedArrayIterator : public std::iterator<std::random_access_iterator_tag,
+                                                       blDataType,
+                                                       ptrdiff_t,
+                                                       const blDataType*,
+                                                       blDataType>
+{
+public:
+
+    blCompressedArrayIterator() : m_array(nullptr),m_index(0),m_value()
+    {
+    }
+
+    blCompressedArrayIterator(const blCompressedArray<blDataType,blBlockSize>* array,
+                              const size_t& index)
+                              : m_array(array),
+                                m_index(index),
+                                m_value()
+    {
+        if(m_array && m_index < m_array->size())
+            m_value = m_array->decodeValue(m_index);
+    }
+
+    blCompressedArrayIterator(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator) = default;
+    ~blCompressedArrayIterator(){}
+
+    blCompressedArrayIterator<blDataType,blBlockSize>&      operator=(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator) = default;
+
+    bool                                                    operator==(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index == iterator.getIndex());}
+    bool                                                    operator!=(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index != iterator.getIndex());}
+    bool                                                    operator<(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index < iterator.getIndex());}
+    bool                                                    operator>(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index > iterator.getIndex());}
+    bool                                                    operator<=(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index <= iterator.getIndex());}
+    bool                                                    operator>=(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index >= iterator.getIndex());}
+
+    // Stepping forward decodes
+    // the next delta, stepping
+    // backward undoes the current
+    // one, stepping across a block's
+    // start reads the block index
+
+    blCompressedArrayIterator<blDataType,blBlockSize>&      operator++()
+    {
+        ++m_index;
+
+        if(m_index < m_array->size())
+        {
+            if(m_index % blBlockSize == 0)
+                m_value = m_array->getBlock(m_index / blBlockSize).m_firstValue;
+            else
+                m_value = m_array->addDelta(m_value,m_index);
+        }
+
+        return (*this);
+    }
+
+    blCompressedArrayIterator<blDataType,blBlockSize>&      operator--()
+    {
+        if(m_index % blBlockSize == 0 || m_index >= m_array->size())
+            m_value = m_array->decodeValue(m_index - 1);
+        else
+            m_value = m_array->subtractDelta(m_value,m_index);
+
+        --m_index;
+
+        return (*this);
+    }
+
+    blCompressedArrayIterator<blDataType,blBlockSize>       operator++(int){auto temp(*this);++(*this);return temp;}
+    blCompressedArrayIterator<blDataType,blBlockSize>       operator--(int){auto temp(*this);--(*this);return temp;}
+
+    // Jumps within the current
+    // block keep decoding from
+    // the current value, other
+    // jumps decode from the
+    // target block's start
+
+    blCompressedArrayIterator<blDataType,blBlockSize>&      operator+=(const ptrdiff_t& movement)
+    {
+        size_t index = m_index + movement;
+
+        if(index < m_array->size())
+        {
+            if(movement > 0 && m_index < m_array->size() && index / blBlockSize == m_index / blBlockSize)
+            {
+                for(size_t i = m_index + 1; i <= index; ++i)
+                    m_value = m_array->addDelta(m_value,i);
+            }
+            else if(movement != 0)
+            {
+                m_value = m_array->decodeValue(index);
+            }
+        }
+
+        m_index = index;
+
+        return (*this);
+    }
+
+    blCompressedArrayIterator<blDataType,blBlockSize>&      operator-=(const ptrdiff_t& movement){return ((*this) += -movement);}
+    blCompressedArrayIterator<blDataType,blBlockSize>       operator+(const ptrdiff_t& movement)const{auto temp(*this);temp += movement;return temp;}
+    blCompressedArrayIterator<blDataType,blBlockSize>       operator-(const ptrdiff_t& movement)const{auto temp(*this);temp -= movement;return temp;}
+
+    ptrdiff_t                                               operator-(const blCompressedArrayIterator<blDataType,blBlockSize>& iterator)const{return static_cast<ptrdiff_t>(m_index) - static_cast<ptrdiff_t>(iterator.getIndex());}
+
+    blDataType                                              operator*()const{return m_value;}
+    const blDataType*                                       operator->()const{return &m_value;}
+    blDataType                                              operator[](const ptrdiff_t& offset)const{return *((*this) + offset);}
+
+    size_t                                                  getIndex()const{return m_index;}
+
+private:
+
+    const blCompressedArray<blDataType,blBlockSize>*        m_array;
+    size_t                                                  m_index;
+    blDataType                                              m_value;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The compressed container
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize = blCompressedArrayBlockSize>
+
+class blCompressedArray
+{
+    static_assert(std::is_integral<blDataType>::value && !std::is_same<blDataType,bool>::value,
+                  "blCompressedArray stores integers");
+
+    static_assert(blBlockSize > 1,"blCompressedArray blocks need at least two values");
+
+public: // Public typedefs
+
+    typedef blDataType                                              value_type;
+
+    typedef typename std::make_unsigned<blDataType>::type           blUnsignedType;
+    typedef blCompressedBlock<blDataType>                           blBlockType;
+
+    typedef blCompressedArrayIterator<blDataType,blBlockSize>       iterator;
+    typedef blCompressedArrayIterator<blDataType,blBlockSize>       const_iterator;
+
+    typedef std::reverse_iterator<const_iterator>                   reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>                   const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blCompressedArray() : m_size(0)
+    {
+    }
+
+    // Constructors compressing
+    // a raw array or a range
+
+    blCompressedArray(const blDataType* values,
+                      const size_t& numberOfValues)
+    {
+        this->compress(values,numberOfValues);
+    }
+
+    template<typename blIteratorType>
+    blCompressedArray(blIteratorType first,
+                      blIteratorType last)
+    {
+        std::vector<blDataType> values(first,last);
+        this->compress(values.data(),values.size());
+    }
+
+    ~blCompressedArray()
+    {
+    }
+
+public: // Public functions
+
+    // Function used to
+    // compress values,
+    // replacing the
+    // current ones
+
+    void                                                    compress(const blDataType* values,
+                                                                     const size_t& numberOfValues);
+
+    // Element access
+    // functions
+
+    blDataType                                              operator[](const size_t& index)const{return this->decodeValue(index);}
+
+    // Functions used to decode
+    // whole blocks or ranges
+    // of values at once
+
+    void                                                    decodeBlock(const size_t& blockIndex,
+                                                                        blDataType* output)const;
+
+    void                                                    decode(const size_t& firstIndex,
+                                                                   const size_t& numberOfValues,
+                                                                   blDataType* output)const;
+
+    void                                                    decode(blDataType* output)const{this->decode(0,m_size,output);}
+
+    // Function used to find
+    // the first value not less
+    // than "value" in a sorted
+    // sequence, binary searching
+    // the block index first
+
+    const_iterator                                          lower_bound(const blDataType& value)const;
+
+    // Functions used to
+    // get the sizes
+
+    size_t                                                  length()const{return m_size;}
+    size_t                                                  size()const{return m_size;}
+    size_t                                                  max_size()const{return m_size;}
+    bool                                                    empty()const{return (m_size == 0);}
+
+    size_t                                                  getNumberOfBlocks()const{return m_blocks.size();}
+    const blBlockType&                                      getBlock(const size_t& blockIndex)const{return m_blocks[blockIndex];}
+
+    size_t                                                  getCompressedSizeInBytes()const{return m_packed.size() + m_blocks.size() * sizeof(blBlockType);}
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    const_iterator                                          begin()const{return const_iterator(this,0);}
+    const_iterator                                          end()const{return const_iterator(this,m_size);}
+    const_iterator                                          cbegin()const{return const_iterator(this,0);}
+    const_iterator                                          cend()const{return const_iterator(this,m_size);}
+
+    const_reverse_iterator                                  rbegin()const{return const_reverse_iterator(this->end());}
+    const_reverse_iterator                                  rend()const{return const_reverse_iterator(this->begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(this->cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(this->cbegin());}
+
+public: // Decoding functions used by the iterators
+
+    // Function used to decode
+    // the value at "index",
+    // walking the deltas from
+    // its block's start
+
+    blDataType                                              decodeValue(const size_t& index)const;
+
+    // Functions used to apply
+    // (or undo) the delta of
+    // the value at "index"
+
+    blDataType                                              addDelta(const blDataType& previousValue,const size_t& index)const
+    {
+        return static_cast<blDataType>(static_cast<blUnsignedType>(static_cast<blUnsignedType>(previousValue) + this->getDelta(index)));
+    }
+
+    blDataType                                              subtractDelta(const blDataType& value,const size_t& index)const
+    {
+        return static_cast<blDataType>(static_cast<blUnsignedType>(static_cast<blUnsignedType>(value) - this->getDelta(index)));
+    }
+
+private: // Private functions
+
+    // The sign bit, flipped so
+    // that deltas compare as
+    // unsigned integers
+
+    static blUnsignedType                                   getSignBit(){return static_cast<blUnsignedType>(blUnsignedType(1) << (8 * sizeof(blDataType) - 1));}
+
+    // Function used to get the
+    // delta of the value at
+    // "index" (which can't be
+    // a block's first value)
+
+    blUnsignedType                                          getDelta(const size_t& index)const
+    {
+        const blBlockType& block = m_blocks[index / blBlockSize];
+
+        uint64_t packedDelta = blGetPackedValue(&m_packed[block.m_byteOffset],index % blBlockSize - 1,block.m_bitWidth);
+
+        return static_cast<blUnsignedType>(static_cast<blUnsignedType>(packedDelta + block.m_minDelta) ^ getSignBit());
+    }
+
+private: // Private variables
+
+    size_t                                                  m_size;
+    std::vector<blBlockType>                                m_blocks;
+    std::vector<uint8_t>                                    m_packed;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+inline void blCompressedArray<blDataType,blBlockSize>::compress(const blDataType* values,
+                                                                const size_t& numberOfValues)
+{
+    m_size = numberOfValues;
+    m_blocks.clear();
+    m_packed.clear();
+
+    size_t byteOffset = 0;
+
+    std::vector<blUnsignedType> biasedDeltas(blBlockSize);
+
+    for(size_t first = 0; first < numberOfValues; first += blBlockSize)
+    {
+        size_t blockSize = std::min(blBlockSize,numberOfValues - first);
+
+        // The deltas, biased so that
+        // their order as signed integers
+        // is their order as unsigned
+
+        blUnsignedType minDelta = blUnsignedType(~blUnsignedType(0));
+        blUnsignedType maxDelta = 0;
+
+        for(size_t i = 1; i < blockSize; ++i)
+        {
+            biasedDeltas[i] = static_cast<blUnsignedType>(static_cast<blUnsignedType>(static_cast<blUnsignedType>(values[first + i]) - static_cast<blUnsignedType>(values[first + i - 1])) ^ getSignBit());
+
+            minDelta = std::min(minDelta,biasedDeltas[i]);
+            maxDelta = std::max(maxDelta,biasedDeltas[i]);
+        }
+
+        if(blockSize == 1)
+            minDelta = maxDelta = 0;
+
+        unsigned bitWidth = 0;
+
+        for(uint64_t range = uint64_t(maxDelta - minDelta); range != 0; range >>= 1)
+            ++bitWidth;
+
+        m_blocks.push_back(blBlockType{values[first],minDelta,byteOffset,bitWidth});
+
+        // Pack the deltas
+
+        size_t numberOfBytes = ((blockSize - 1) * bitWidth + 7) / 8;
+
+        m_packed.resize(byteOffset + numberOfBytes,0);
+
+        for(size_t i = 1; i < blockSize; ++i)
+            blSetPackedValue(m_packed.data() + byteOffset,i - 1,bitWidth,uint64_t(static_cast<blUnsignedType>(biasedDeltas[i] - minDelta)));
+
+        byteOffset += numberOfBytes;
+    }
+
+    // The padding read past
+    // the last packed value
+
+    m_packed.resize(byteOffset + 16,0);
+    m_packed.shrink_to_fit();
+    m_blocks.shrink_to_fit();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+inline blDataType blCompressedArray<blDataType,blBlockSize>::decodeValue(const size_t& index)const
+{
+    size_t first = index - index % blBlockSize;
+
+    blDataType value = m_blocks[index / blBlockSize].m_firstValue;
+
+    for(size_t i = first + 1; i <= index; ++i)
+        value = this->addDelta(value,i);
+
+    return value;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+inline void blCompressedArray<blDataType,blBlockSize>::decodeBlock(const size_t& blockIndex,
+                                                                   blDataType* output)const
+{
+    const blBlockType& block = m_blocks[blockIndex];
+
+    size_t blockSize = std::min(blBlockSize,m_size - blockIndex * blBlockSize);
+
+    // Unpack the deltas
+    // and add them up
+
+    uint64_t packedDeltas[blBlockSize];
+
+    blGetUnpackFunction(block.m_bitWidth)(&m_packed[block.m_byteOffset],blockSize - 1,packedDeltas);
+
+    blUnsignedType value = static_cast<blUnsignedType>(block.m_firstValue);
+
+    output[0] = block.m_firstValue;
+
+    for(size_t i = 1; i < blockSize; ++i)
+    {
+        value = static_cast<blUnsignedType>(value + static_cast<blUnsignedType>(static_cast<blUnsignedType>(packedDeltas[i - 1] + block.m_minDelta) ^ getSignBit()));
+        output[i] = static_cast<blDataType>(value);
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+inline void blCompressedArray<blDataType,blBlockSize>::decode(const size_t& firstIndex,
+                                                              const size_t& numberOfValues,
+                                                              blDataType* output)const
+{
+    size_t index = firstIndex;
+    size_t lastIndex = std::min(m_size,firstIndex + numberOfValues);
+
+    blDataType block[blBlockSize];
+
+    while(index < lastIndex)
+    {
+        size_t blockIndex = index / blBlockSize;
+        size_t blockFirst = blockIndex * blBlockSize;
+        size_t blockLast = std::min(blockFirst + blBlockSize,lastIndex);
+
+        // Whole blocks are decoded
+        // straight into the output
+
+        if(index == blockFirst && blockLast - blockFirst == std::min(blBlockSize,m_size - blockFirst))
+        {
+            this->decodeBlock(blockIndex,output);
+        }
+        else
+        {
+            this->decodeBlock(blockIndex,block);
+            std::copy(block + (index - blockFirst),block + (blockLast - blockFirst),output);
+        }
+
+        output += blockLast - index;
+        index = blockLast;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+inline typename blCompressedArray<blDataType,blBlockSize>::const_iterator
+blCompressedArray<blDataType,blBlockSize>::lower_bound(const blDataType& value)const
+{
+    // Find the last block whose
+    // first value is less than
+    // "value", the value can only
+    // be in that block (or be the
+    // next block's first value)
+
+    auto block = std::lower_bound(m_blocks.begin(),
+                                  m_blocks.end(),
+                                  value,
+                                  [](const blBlockType& block,const blDataType& value){return block.m_firstValue < value;});
+
+    if(block == m_blocks.begin())
+        return this->begin();
+
+    size_t blockIndex = static_cast<size_t>(block - m_blocks.begin()) - 1;
+
+    const_iterator iter(this,blockIndex * blBlockSize);
+    const_iterator blockEnd(this,std::min(m_size,(blockIndex + 1) * blBlockSize));
+
+    while(iter != blockEnd && *iter < value)
+        ++iter;
+
+    return iter;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_COMPRESSEDARRAY_HPP
@@ -0,0 +1,545 @@
+#ifndef BL_DECIMATINGITERATOR_HPP
+#define BL_DECIMATINGITERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blDecimatingIterator.hpp
+// CLASS:           blDecimatingIterator
+//                  blMeanAggregator
+//                  blMinAggregator
+//                  blMaxAggregator
+//                  blMinMaxAggregator
+//                  blFirstAggregator
+//                  blLttbAggregator
+// BASE CLASS:      None
+//
+// PURPOSE:         An input iterator downsampling a blIterator
+//                  range (linear or circular, over contiguous or
+//                  segmented containers), where each step yields
+//                  one aggregate of the next "M" elements (a
+//                  bucket) of the range.
+//
+//                  The aggregate is computed by an aggregator
+//                  functor:
+//
+//                  - blMeanAggregator -- The bucket's mean
+//                  - blMinAggregator -- The bucket's min
+//                  - blMaxAggregator -- The bucket's max
+//                  - blMinMaxAggregator -- The bucket's min and max
+//                                          (for min/max envelopes)
+//                  - blFirstAggregator -- The bucket's first element
+//                  - blLttbAggregator -- The element of the bucket
+//                                        forming the largest triangle
+//                                        with the previously selected
+//                                        element and the next bucket's
+//                                        mean (Largest Triangle Three
+//                                        Buckets)
+//
+//                  Buckets are walked one contiguous piece at a
+//                  time (see blForEachSegment), and the means,
+//                  mins and maxs of the pieces are computed by
+//                  the vectorized blSimdAlgorithms kernels.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blIterator
+//                  - blSimdAlgorithms -- blForEachSegment, blSum
+//                                        and blSimdMinMax
+//
+// NOTES:           - The last bucket is shorter than the others
+//                    when the range's length isn't a multiple of
+//                    the bucket size
+//
+//                  - Aggregators are called with the bucket's
+//                    first element, the bucket's size, the size
+//                    of the next bucket (zero for the last one)
+//                    and the bucket's offset from the range's
+//                    beginning
+//
+//                  - Default constructed decimating iterators
+//                    are "end" iterators, and decimating iterators
+//                    only compare as done or not done, so the only
+//                    meaningful comparison is against one
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get the sum,
+// min and max of the "n" elements
+// of a bucket
+//-------------------------------------------------------------------
+template<typename blIteratorType>
+inline typename blSumType<typename blIteratorType::blDataType>::type blBucketSum(const blIteratorType& bucketBegin,
+                                                                                 const ptrdiff_t& bucketSize)
+{
+    typedef decltype(getDataPointer(bucketBegin.getPtr()))  blPointerType;
+
+    typename blSumType<typename blIteratorType::blDataType>::type sum = 0;
+
+    blForEachSegment(bucketBegin,bucketSize,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t&)
+    {
+        sum += blSum(begin,end);
+        return true;
+    });
+
+    return sum;
+}
+
+template<typename blIteratorType>
+inline void blBucketMinMax(const blIteratorType& bucketBegin,
+                           const ptrdiff_t& bucketSize,
+                           typename blIteratorType::blDataType& minValue,
+                           typename blIteratorType::blDataType& maxValue)
+{
+    typedef typename blIteratorType::blDataType             blDataType;
+    typedef decltype(getDataPointer(bucketBegin.getPtr()))  blPointerType;
+
+    minValue = (*bucketBegin);
+    maxValue = (*bucketBegin);
+
+    blForEachSegment(bucketBegin,bucketSize,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t&)
+    {
+        blDataType segmentMin,segmentMax;
+
+        blSimdMinMax<blDataType>(begin,end,segmentMin,segmentMax,blGetSimdLevelForType<blDataType>());
+
+        if(segmentMin < minValue)
+            minValue = segmentMin;
+
+        if(maxValue < segmentMax)
+            maxValue = segmentMax;
+
+        return true;
+    });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The aggregators
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blMeanAggregator
+{
+    typedef typename std::conditional<std::is_floating_point<blDataType>::value,blDataType,double>::type    blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t& bucketSize,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&)
+    {
+        return static_cast<blResultType>(static_cast<double>(blBucketSum(bucketBegin,bucketSize)) / static_cast<double>(bucketSize));
+    }
+};
+
+template<typename blDataType>
+struct blMinAggregator
+{
+    typedef blDataType                                      blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t& bucketSize,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&)
+    {
+        blDataType minValue,maxValue;
+        blBucketMinMax(bucketBegin,bucketSize,minValue,maxValue);
+        return minValue;
+    }
+};
+
+template<typename blDataType>
+struct blMaxAggregator
+{
+    typedef blDataType                                      blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t& bucketSize,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&)
+    {
+        blDataType minValue,maxValue;
+        blBucketMinMax(bucketBegin,bucketSize,minValue,maxValue);
+        return maxValue;
+    }
+};
+
+template<typename blDataType>
+struct blMinMaxAggregator
+{
+    typedef std::pair<blDataType,blDataType>                blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t& bucketSize,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&)
+    {
+        blResultType minMax;
+        blBucketMinMax(bucketBegin,bucketSize,minMax.first,minMax.second);
+        return minMax;
+    }
+};
+
+template<typename blDataType>
+struct blFirstAggregator
+{
+    typedef blDataType                                      blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&,
+                            const ptrdiff_t&)
+    {
+        return (*bucketBegin);
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The LTTB aggregator, which treats
+// the elements as points (offset,value)
+//
+// NOTE:    - The first bucket selects
+//            its first element, and the
+//            last bucket compares against
+//            its own last element instead
+//            of the next bucket's mean
+//
+//          - It remembers the element it
+//            selected, so every aggregator
+//            can only walk one range, in
+//            order
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blLttbAggregator
+{
+    typedef blDataType                                      blResultType;
+
+    template<typename blIteratorType>
+    blResultType operator()(const blIteratorType& bucketBegin,
+                            const ptrdiff_t& bucketSize,
+                            const ptrdiff_t& nextBucketSize,
+                            const ptrdiff_t& bucketOffset);
+
+    // The offset (from the range's
+    // beginning) of the last selected
+    // element
+
+    ptrdiff_t                                               getSelectedOffset()const{return m_selectedOffset;}
+
+    ptrdiff_t                                               m_selectedOffset = -1;
+    double                                                  m_selectedValue = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType>
+template<typename blIteratorType>
+inline typename blLttbAggregator<blDataType>::blResultType blLttbAggregator<blDataType>::operator()(const blIteratorType& bucketBegin,
+                                                                                                   const ptrdiff_t& bucketSize,
+                                                                                                   const ptrdiff_t& nextBucketSize,
+                                                                                                   const ptrdiff_t& bucketOffset)
+{
+    typedef decltype(getDataPointer(bucketBegin.getPtr()))  blPointerType;
+
+    if(m_selectedOffset < 0)
+    {
+        m_selectedOffset = bucketOffset;
+        m_selectedValue = static_cast<double>(*bucketBegin);
+
+        return (*bucketBegin);
+    }
+
+    // The third point of the
+    // triangles
+
+    double nextX;
+    double nextY;
+
+    if(nextBucketSize > 0)
+    {
+        nextX = static_cast<double>(bucketOffset + bucketSize) + 0.5 * static_cast<double>(nextBucketSize - 1);
+        nextY = static_cast<double>(blBucketSum(bucketBegin + bucketSize,nextBucketSize)) / static_cast<double>(nextBucketSize);
+    }
+    else
+    {
+        nextX = static_cast<double>(bucketOffset + bucketSize - 1);
+        nextY = static_cast<double>(*(bucketBegin + (bucketSize - 1)));
+    }
+
+    // Twice the triangle's area is
+    // |a * y + b * x + c|, a linear
+    // function of the point (x,y)
+
+    double previousX = static_cast<double>(m_selectedOffset);
+    double previousY = m_selectedValue;
+
+    double a = previousX - nextX;
+    double b = nextY - previousY;
+    double c = -a * previousY - b * previousX;
+
+    double largestArea = -1;
+    ptrdiff_t selectedOffset = bucketOffset;
+    blDataType selectedValue = (*bucketBegin);
+
+    blForEachSegment(bucketBegin,bucketSize,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t& offset)
+    {
+        double x = static_cast<double>(bucketOffset + offset);
+
+        for(blPointerType point = begin; point != end; ++point,x += 1)
+        {
+            double area = std::abs(a * static_cast<double>(*point) + b * x + c);
+
+            if(area > largestArea)
+            {
+                largestArea = area;
+                selectedOffset = bucketOffset + offset + (point - begin);
+                selectedValue = (*point);
+            }
+        }
+
+        return true;
+    });
+
+    m_selectedOffset = selectedOffset;
+    m_selectedValue = static_cast<double>(selectedValue);
+
+    return selectedValue;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,
+         typename blAggregatorType = blMeanAggregator<typename blIteratorType::blDataType> >
+
+class blDecimatingIterator : public std::iterator<std::input_iterator_tag,
+                                                  typename blAggregatorType::blResultType,
+                                                  ptrdiff_t,
+                                                  const typename blAggregatorType::blResultType*,
+                                                  const typename blAggregatorType::blResultType&>
+{
+public: // Public typedefs
+
+    typedef typename blAggregatorType::blResultType                         blResultType;
+
+public: // Constructors and destructors
+
+    // Default constructor,
+    // giving an "end" iterator
+
+    blDecimatingIterator() = default;
+
+    // Constructor from the first
+    // element of the range, its
+    // length and the bucket size
+
+    blDecimatingIterator(const blIteratorType& first,
+                         const size_t& numberOfElements,
+                         const size_t& bucketSize,
+                         const blAggregatorType& aggregator = blAggregatorType());
+
+    // Copy constructor
+
+    blDecimatingIterator(const blDecimatingIterator<blIteratorType,blAggregatorType>& decimatingIterator) = default;
+
+    // Destructor
+
+    ~blDecimatingIterator(){}
+
+public: // Overloaded operators
+
+    blDecimatingIterator<blIteratorType,blAggregatorType>&  operator=(const blDecimatingIterator<blIteratorType,blAggregatorType>& decimatingIterator) = default;
+
+    // Iterators are equal when
+    // both are (or both aren't)
+    // done, see NOTES
+
+    bool                                                    operator==(const blDecimatingIterator<blIteratorType,blAggregatorType>& decimatingIterator)const{return (this->done() == decimatingIterator.done());}
+    bool                                                    operator!=(const blDecimatingIterator<blIteratorType,blAggregatorType>& decimatingIterator)const{return (this->done() != decimatingIterator.done());}
+
+    explicit operator                                       bool()const{return (m_numberOfRemainingElements > 0);}
+
+    // Dereferencing gives the
+    // current bucket's aggregate
+
+    const blResultType&                                     operator*()const{return m_value;}
+    const blResultType*                                     operator->()const{return std::addressof(m_value);}
+
+    blDecimatingIterator<blIteratorType,blAggregatorType>&  operator++(){this->nextBucket();return (*this);}
+    blDecimatingIterator<blIteratorType,blAggregatorType>   operator++(int){auto temp(*this);this->nextBucket();return temp;}
+
+public: // Public functions
+
+    // Function used to write the
+    // next (up to) "n" aggregates
+    // into a buffer, returning
+    // how many were written
+
+    size_t                                                  fill(blResultType* output,
+                                                                 const size_t& n);
+
+    // Functions used to get
+    // the number of buckets
+    // left
+
+    size_t                                                  size()const{return (m_bucketSize > 0 ? (m_numberOfRemainingElements + m_bucketSize - 1) / m_bucketSize : 0);}
+    bool                                                    empty()const{return (m_numberOfRemainingElements == 0);}
+    bool                                                    done()const{return (m_numberOfRemainingElements == 0);}
+
+    size_t                                                  getBucketSize()const{return m_bucketSize;}
+
+    // The offset of the current
+    // bucket from the range's
+    // beginning
+
+    size_t                                                  getBucketOffset()const{return m_bucketOffset;}
+
+    const blAggregatorType&                                 getAggregator()const{return m_aggregator;}
+
+private: // Private functions
+
+    // Function used to aggregate
+    // the current bucket
+
+    void                                                    aggregate()
+    {
+        if(m_numberOfRemainingElements == 0)
+            return;
+
+        size_t currentBucketSize = std::min(m_bucketSize,m_numberOfRemainingElements);
+        size_t nextBucketSize = std::min(m_bucketSize,m_numberOfRemainingElements - currentBucketSize);
+
+        m_value = m_aggregator(m_bucketBegin,
+                               static_cast<ptrdiff_t>(currentBucketSize),
+                               static_cast<ptrdiff_t>(nextBucketSize),
+                               static_cast<ptrdiff_t>(m_bucketOffset));
+    }
+
+    // Function used to move
+    // to the next bucket
+
+    void                                                    nextBucket()
+    {
+        if(m_numberOfRemainingElements == 0)
+            return;
+
+        size_t currentBucketSize = std::min(m_bucketSize,m_numberOfRemainingElements);
+
+        m_numberOfRemainingElements -= currentBucketSize;
+        m_bucketOffset += currentBucketSize;
+
+        if(m_numberOfRemainingElements > 0)
+        {
+            m_bucketBegin += static_cast<ptrdiff_t>(currentBucketSize);
+            this->aggregate();
+        }
+    }
+
+private: // Private variables
+
+    // The current bucket's first
+    // element and aggregate
+
+    blIteratorType                                          m_bucketBegin;
+    blResultType                                            m_value = blResultType();
+
+    size_t                                                  m_bucketSize = 0;
+    size_t                                                  m_bucketOffset = 0;
+    size_t                                                  m_numberOfRemainingElements = 0;
+
+    blAggregatorType                                        m_aggregator;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,typename blAggregatorType>
+inline blDecimatingIterator<blIteratorType,blAggregatorType>::blDecimatingIterator(const blIteratorType& first,
+                                                                                   const size_t& numberOfElements,
+                                                                                   const size_t& bucketSize,
+                                                                                   const blAggregatorType& aggregator)
+                                                                                   : m_bucketBegin(first),
+                                                                                     m_bucketSize(bucketSize),
+                                                                                     m_numberOfRemainingElements(bucketSize > 0 ? numberOfElements : 0),
+                                                                                     m_aggregator(aggregator)
+{
+    this->aggregate();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,typename blAggregatorType>
+inline size_t blDecimatingIterator<blIteratorType,blAggregatorType>::fill(blResultType* output,
+                                                                          const size_t& n)
+{
+    size_t numberOfBuckets = 0;
+
+    for(; numberOfBuckets < n && m_numberOfRemainingElements > 0; ++numberOfBuckets)
+    {
+        output[numberOfBuckets] = m_value;
+        this->nextBucket();
+    }
+
+    return numberOfBuckets;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get a decimating
+// iterator over the "n" elements
+// starting at "first", or over the
+// range [first,last)
+//
+// NOTE:    Circular ranges given by
+//          their length can go around
+//          their container more than
+//          once
+//-------------------------------------------------------------------
+template<template<typename> class blAggregatorTemplate = blMeanAggregator,
+         typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline blDecimatingIterator<blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>,
+                            blAggregatorTemplate<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+getDecimatingIterator(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                      const size_t& numberOfElements,
+                      const size_t& bucketSize)
+{
+    typedef blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>   blIteratorType;
+
+    return blDecimatingIterator< blIteratorType,blAggregatorTemplate<typename blIteratorType::blDataType> >(first,numberOfElements,bucketSize);
+}
+
+template<template<typename> class blAggregatorTemplate = blMeanAggregator,
+         typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline blDecimatingIterator<blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>,
+                            blAggregatorTemplate<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+getDecimatingIterator(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                      const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                      const size_t& bucketSize)
+{
+    ptrdiff_t numberOfElements = last - first;
+
+    return getDecimatingIterator<blAggregatorTemplate>(first,numberOfElements > 0 ? size_t(numberOfElements) : size_t(0),bucketSize);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_DECIMATINGITERATOR_HPP
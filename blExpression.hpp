@@ -0,0 +1,455 @@
+#ifndef BL_EXPRESSION_HPP
+#define BL_EXPRESSION_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blExpression.hpp
+// CLASS:           blExpression
+//                  blArrayExpression
+//                  blRawArrayWrapperExpression
+//                  blScalarExpression
+//                  blUnaryExpression
+//                  blBinaryExpression
+// BASE CLASS:      None
+//
+// PURPOSE:         Expression templates for element-wise
+//                  arithmetic, comparisons and math functions
+//                  on blArrays and blRawArrayWrappers.
+//
+//                  Writing:
+//
+//                  a = b * c + d;
+//
+//                  does not compute "b * c" into a temporary
+//                  array, it builds a small expression object
+//                  which is only evaluated when assigned to
+//                  "a", in a single loop computing every
+//                  element of "a" at once.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blArray
+//                  - blRawArrayWrapper
+//
+// NOTES:           - When both sides of an operation are
+//                    blArrays, their sizes are checked at
+//                    compile time.  When any side has a
+//                    run time size (a blRawArrayWrapper),
+//                    the expression covers the shortest side
+//
+//                  - Expressions keep references to the
+//                    blArrays they use, so they should be
+//                    assigned before those arrays go out of
+//                    scope, and never built from temporary
+//                    blArrays
+//
+//                  - Element-wise equality is "equalTo" and
+//                    "notEqualTo", because blArray's own ==
+//                    and != compare whole arrays
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Forward declarations
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+class blArray;
+
+template<typename blDataType>
+class blRawArrayWrapper;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Static sizes of expressions
+//
+// NOTE:    - blDynamicSize -- The size is only
+//                             known at run time
+//
+//          - blAnySize -- Scalars, which fit
+//                         expressions of any
+//                         size
+//-------------------------------------------------------------------
+const size_t                                                blDynamicSize = 0;
+const size_t                                                blAnySize = size_t(-1);
+
+template<size_t blStaticSize1,size_t blStaticSize2>
+struct blCombinedStaticSize
+{
+    static const size_t value = (blStaticSize1 == blAnySize ? blStaticSize2 :
+                                 blStaticSize2 == blAnySize ? blStaticSize1 :
+                                 (blStaticSize1 == blDynamicSize || blStaticSize2 == blDynamicSize) ? blDynamicSize :
+                                 blStaticSize1);
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The base of every expression
+//
+// NOTE:    Every expression defines:
+//
+//          - blStaticSize
+//          - size()
+//          - operator[](index)
+//-------------------------------------------------------------------
+template<typename blDerivedType>
+
+class blExpression
+{
+public: // Public functions
+
+    const blDerivedType&                                    getDerived()const{return static_cast<const blDerivedType&>(*this);}
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The leaves of the expressions
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize>
+
+class blArrayExpression : public blExpression< blArrayExpression<blDataType,blArraySize> >
+{
+public:
+
+    static const size_t                                     blStaticSize = blArraySize;
+
+    template<size_t blAlignment>
+    blArrayExpression(const blArray<blDataType,blArraySize,blAlignment>& array) : m_data(array.data())
+    {
+    }
+
+    size_t                                                  size()const{return blArraySize;}
+    const blDataType&                                       operator[](const size_t& index)const{return m_data[index];}
+
+private:
+
+    const blDataType*                                       m_data;
+};
+
+template<typename blDataType>
+
+class blRawArrayWrapperExpression : public blExpression< blRawArrayWrapperExpression<blDataType> >
+{
+public:
+
+    static const size_t                                     blStaticSize = blDynamicSize;
+
+    blRawArrayWrapperExpression(const blRawArrayWrapper<blDataType>& rawArrayWrapper)
+                                : m_data(rawArrayWrapper.getContainerIter().getPtr()),
+                                  m_size(rawArrayWrapper.size())
+    {
+    }
+
+    size_t                                                  size()const{return m_size;}
+    const blDataType&                                       operator[](const size_t& index)const{return m_data[index];}
+
+private:
+
+    const blDataType*                                       m_data;
+    size_t                                                  m_size;
+};
+
+template<typename blDataType>
+
+class blScalarExpression : public blExpression< blScalarExpression<blDataType> >
+{
+public:
+
+    static const size_t                                     blStaticSize = blAnySize;
+
+    blScalarExpression(const blDataType& value) : m_value(value)
+    {
+    }
+
+    size_t                                                  size()const{return blAnySize;}
+    const blDataType&                                       operator[](const size_t&)const{return m_value;}
+
+private:
+
+    blDataType                                              m_value;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The nodes of the expressions
+//-------------------------------------------------------------------
+template<typename blOperandType,typename blOperationType>
+
+class blUnaryExpression : public blExpression< blUnaryExpression<blOperandType,blOperationType> >
+{
+public:
+
+    static const size_t                                     blStaticSize = blOperandType::blStaticSize;
+
+    blUnaryExpression(const blOperandType& operand) : m_operand(operand)
+    {
+    }
+
+    size_t                                                  size()const{return m_operand.size();}
+
+    auto                                                    operator[](const size_t& index)const->decltype(blOperationType::apply(std::declval<const blOperandType&>()[index]))
+    {
+        return blOperationType::apply(m_operand[index]);
+    }
+
+private:
+
+    blOperandType                                           m_operand;
+};
+
+template<typename blOperandType1,typename blOperandType2,typename blOperationType>
+
+class blBinaryExpression : public blExpression< blBinaryExpression<blOperandType1,blOperandType2,blOperationType> >
+{
+public:
+
+    static const size_t                                     blStaticSize = blCombinedStaticSize<blOperandType1::blStaticSize,
+                                                                                                blOperandType2::blStaticSize>::value;
+
+    // Checked in the class body so
+    // that it fires as soon as the
+    // expression is built, the static
+    // size above is only evaluated
+    // when something reads it
+
+    static_assert(blOperandType1::blStaticSize == blAnySize || blOperandType2::blStaticSize == blAnySize ||
+                  blOperandType1::blStaticSize == blDynamicSize || blOperandType2::blStaticSize == blDynamicSize ||
+                  blOperandType1::blStaticSize == blOperandType2::blStaticSize,
+                  "blExpression operands have different sizes");
+
+    blBinaryExpression(const blOperandType1& operand1,
+                       const blOperandType2& operand2)
+                       : m_operand1(operand1),
+                         m_operand2(operand2)
+    {
+    }
+
+    size_t                                                  size()const{return std::min(m_operand1.size(),m_operand2.size());}
+
+    auto                                                    operator[](const size_t& index)const->decltype(blOperationType::apply(std::declval<const blOperandType1&>()[index],
+                                                                                                                                  std::declval<const blOperandType2&>()[index]))
+    {
+        return blOperationType::apply(m_operand1[index],m_operand2[index]);
+    }
+
+private:
+
+    blOperandType1                                          m_operand1;
+    blOperandType2                                          m_operand2;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Traits turning operands into
+// expressions
+//-------------------------------------------------------------------
+template<typename blOperandType,typename blEnableType = void>
+struct blAsExpression
+{
+    static const bool                                       m_isExpression = false;
+    static const bool                                       m_isScalar = false;
+};
+
+template<typename blOperandType>
+struct blAsExpression<blOperandType,typename std::enable_if<std::is_base_of<blExpression<blOperandType>,blOperandType>::value>::type>
+{
+    static const bool                                       m_isExpression = true;
+    static const bool                                       m_isScalar = false;
+
+    typedef blOperandType                                   type;
+
+    static const type&                                      get(const blOperandType& operand){return operand;}
+};
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment>
+struct blAsExpression< blArray<blDataType,blArraySize,blAlignment> >
+{
+    static const bool                                       m_isExpression = true;
+    static const bool                                       m_isScalar = false;
+
+    typedef blArrayExpression<blDataType,blArraySize>       type;
+
+    static type                                             get(const blArray<blDataType,blArraySize,blAlignment>& operand){return type(operand);}
+};
+
+template<typename blDataType>
+struct blAsExpression< blRawArrayWrapper<blDataType> >
+{
+    static const bool                                       m_isExpression = true;
+    static const bool                                       m_isScalar = false;
+
+    typedef blRawArrayWrapperExpression<blDataType>         type;
+
+    static type                                             get(const blRawArrayWrapper<blDataType>& operand){return type(operand);}
+};
+
+template<typename blOperandType>
+struct blAsExpression<blOperandType,typename std::enable_if<std::is_arithmetic<blOperandType>::value>::type>
+{
+    static const bool                                       m_isExpression = false;
+    static const bool                                       m_isScalar = true;
+
+    typedef blScalarExpression<blOperandType>               type;
+
+    static type                                             get(const blOperandType& operand){return type(operand);}
+};
+
+// Used to enable the operators only
+// when one operand is an expression
+// and the other one an expression
+// or a scalar
+
+template<typename blOperandType1,typename blOperandType2>
+struct blAreExpressionOperands : std::integral_constant<bool,
+                                                        (blAsExpression<blOperandType1>::m_isExpression && (blAsExpression<blOperandType2>::m_isExpression || blAsExpression<blOperandType2>::m_isScalar)) ||
+                                                        (blAsExpression<blOperandType2>::m_isExpression && blAsExpression<blOperandType1>::m_isScalar)>
+{
+};
+
+template<typename blOperandType1,typename blOperandType2,typename blOperationType>
+using blBinaryExpressionType = typename std::enable_if<blAreExpressionOperands<blOperandType1,blOperandType2>::value,
+                                                       blBinaryExpression<typename blAsExpression<blOperandType1>::type,
+                                                                          typename blAsExpression<blOperandType2>::type,
+                                                                          blOperationType> >::type;
+
+template<typename blOperandType,typename blOperationType>
+using blUnaryExpressionType = typename std::enable_if<blAsExpression<blOperandType>::m_isExpression,
+                                                      blUnaryExpression<typename blAsExpression<blOperandType>::type,
+                                                                        blOperationType> >::type;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The operations
+//-------------------------------------------------------------------
+#define BL_EXPRESSION_BINARY_OPERATION(blOperationName,blOperation)                                     \
+struct blOperationName                                                                                  \
+{                                                                                                       \
+    template<typename blDataType1,typename blDataType2>                                                 \
+    static auto apply(const blDataType1& a,const blDataType2& b)->decltype(blOperation){return blOperation;} \
+};
+
+BL_EXPRESSION_BINARY_OPERATION(blAddOperation,a + b)
+BL_EXPRESSION_BINARY_OPERATION(blSubtractOperation,a - b)
+BL_EXPRESSION_BINARY_OPERATION(blMultiplyOperation,a * b)
+BL_EXPRESSION_BINARY_OPERATION(blDivideOperation,a / b)
+BL_EXPRESSION_BINARY_OPERATION(blLessOperation,a < b)
+BL_EXPRESSION_BINARY_OPERATION(blLessEqualOperation,a <= b)
+BL_EXPRESSION_BINARY_OPERATION(blGreaterOperation,a > b)
+BL_EXPRESSION_BINARY_OPERATION(blGreaterEqualOperation,a >= b)
+BL_EXPRESSION_BINARY_OPERATION(blEqualToOperation,a == b)
+BL_EXPRESSION_BINARY_OPERATION(blNotEqualToOperation,a != b)
+BL_EXPRESSION_BINARY_OPERATION(blMinOperation,(b < a ? b : a))
+BL_EXPRESSION_BINARY_OPERATION(blMaxOperation,(a < b ? b : a))
+BL_EXPRESSION_BINARY_OPERATION(blPowOperation,std::pow(a,b))
+BL_EXPRESSION_BINARY_OPERATION(blAtan2Operation,std::atan2(a,b))
+
+#undef BL_EXPRESSION_BINARY_OPERATION
+
+#define BL_EXPRESSION_UNARY_OPERATION(blOperationName,blOperation)                                      \
+struct blOperationName                                                                                  \
+{                                                                                                       \
+    template<typename blDataType>                                                                       \
+    static auto apply(const blDataType& a)->decltype(blOperation){return blOperation;}                  \
+};
+
+BL_EXPRESSION_UNARY_OPERATION(blNegateOperation,-a)
+BL_EXPRESSION_UNARY_OPERATION(blAbsOperation,std::abs(a))
+BL_EXPRESSION_UNARY_OPERATION(blSqrtOperation,std::sqrt(a))
+BL_EXPRESSION_UNARY_OPERATION(blExpOperation,std::exp(a))
+BL_EXPRESSION_UNARY_OPERATION(blLogOperation,std::log(a))
+BL_EXPRESSION_UNARY_OPERATION(blSinOperation,std::sin(a))
+BL_EXPRESSION_UNARY_OPERATION(blCosOperation,std::cos(a))
+BL_EXPRESSION_UNARY_OPERATION(blTanOperation,std::tan(a))
+BL_EXPRESSION_UNARY_OPERATION(blFloorOperation,std::floor(a))
+BL_EXPRESSION_UNARY_OPERATION(blCeilOperation,std::ceil(a))
+
+#undef BL_EXPRESSION_UNARY_OPERATION
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The operators and functions
+// building the expressions
+//-------------------------------------------------------------------
+#define BL_EXPRESSION_BINARY_FUNCTION(blFunctionName,blOperationName)                                   \
+template<typename blOperandType1,typename blOperandType2>                                               \
+inline blBinaryExpressionType<blOperandType1,blOperandType2,blOperationName> blFunctionName(const blOperandType1& operand1,const blOperandType2& operand2) \
+{                                                                                                       \
+    return blBinaryExpressionType<blOperandType1,blOperandType2,blOperationName>(blAsExpression<blOperandType1>::get(operand1), \
+                                                                                 blAsExpression<blOperandType2>::get(operand2)); \
+}
+
+BL_EXPRESSION_BINARY_FUNCTION(operator+,blAddOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator-,blSubtractOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator*,blMultiplyOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator/,blDivideOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator<,blLessOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator<=,blLessEqualOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator>,blGreaterOperation)
+BL_EXPRESSION_BINARY_FUNCTION(operator>=,blGreaterEqualOperation)
+BL_EXPRESSION_BINARY_FUNCTION(equalTo,blEqualToOperation)
+BL_EXPRESSION_BINARY_FUNCTION(notEqualTo,blNotEqualToOperation)
+BL_EXPRESSION_BINARY_FUNCTION(min,blMinOperation)
+BL_EXPRESSION_BINARY_FUNCTION(max,blMaxOperation)
+BL_EXPRESSION_BINARY_FUNCTION(pow,blPowOperation)
+BL_EXPRESSION_BINARY_FUNCTION(atan2,blAtan2Operation)
+
+#undef BL_EXPRESSION_BINARY_FUNCTION
+
+#define BL_EXPRESSION_UNARY_FUNCTION(blFunctionName,blOperationName)                                    \
+template<typename blOperandType>                                                                        \
+inline blUnaryExpressionType<blOperandType,blOperationName> blFunctionName(const blOperandType& operand) \
+{                                                                                                       \
+    return blUnaryExpressionType<blOperandType,blOperationName>(blAsExpression<blOperandType>::get(operand)); \
+}
+
+BL_EXPRESSION_UNARY_FUNCTION(operator-,blNegateOperation)
+BL_EXPRESSION_UNARY_FUNCTION(abs,blAbsOperation)
+BL_EXPRESSION_UNARY_FUNCTION(sqrt,blSqrtOperation)
+BL_EXPRESSION_UNARY_FUNCTION(exp,blExpOperation)
+BL_EXPRESSION_UNARY_FUNCTION(log,blLogOperation)
+BL_EXPRESSION_UNARY_FUNCTION(sin,blSinOperation)
+BL_EXPRESSION_UNARY_FUNCTION(cos,blCosOperation)
+BL_EXPRESSION_UNARY_FUNCTION(tan,blTanOperation)
+BL_EXPRESSION_UNARY_FUNCTION(floor,blFloorOperation)
+BL_EXPRESSION_UNARY_FUNCTION(ceil,blCeilOperation)
+
+#undef BL_EXPRESSION_UNARY_FUNCTION
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to evaluate an expression
+// into "numberOfElements" elements of a
+// destination, in a single loop
+//-------------------------------------------------------------------
+template<typename blDataType,typename blExpressionType>
+inline void blEvaluateExpression(blDataType* destination,
+                                 const size_t& numberOfElements,
+                                 const blExpression<blExpressionType>& expression)
+{
+    const blExpressionType& derivedExpression = expression.getDerived();
+
+    const size_t numberOfElementsToEvaluate = std::min(numberOfElements,derivedExpression.size());
+
+    for(size_t i = 0; i < numberOfElementsToEvaluate; ++i)
+        destination[i] = derivedExpression[i];
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_EXPRESSION_HPP
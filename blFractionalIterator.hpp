@@ -0,0 +1,622 @@
+#ifndef BL_FRACTIONALITERATOR_HPP
+#define BL_FRACTIONALITERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blFractionalIterator.hpp
+// CLASS:           blLinearInterpolator
+//                  blCubicInterpolator
+//                  blSincInterpolator
+//                  blFractionalIterator
+// BASE CLASS:      None
+//
+// PURPOSE:         A circular iterator stepping through an
+//                  array of samples at a non integer rate
+//                  (resampling, wavetable oscillators), which
+//                  dereferences to the samples interpolated at
+//                  its fractional position.
+//
+//                  The position is a 32.32 fixed point phase
+//                  (32 bits of index and 32 bits of fraction),
+//                  advanced by adding a fixed point increment,
+//                  so it never drifts the way a floating point
+//                  index does and stepping is an integer add.
+//
+//                  The interpolation is chosen through an
+//                  interpolator policy:
+//
+//                  - blLinearInterpolator -- 2 samples
+//                  - blCubicInterpolator -- 4 samples (Catmull-Rom)
+//                  - blSincInterpolator -- Windowed sinc with
+//                                          a precomputed table
+//
+//                  "render" produces a whole block of output
+//                  samples, splitting it into runs where the
+//                  samples needed don't wrap around the array,
+//                  so the inner loop has no branches nor modulo
+//                  and can be vectorized by the compiler.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper
+//                  - blIteratorTraits -- getDataPointer
+//
+// NOTES:           - The samples have to be floating point and
+//                    the array has to hold fewer than 2^30 of them
+//                    (so that adding two phases can't overflow)
+//
+//                  - The rate can be negative (moving backward),
+//                    its magnitude is reduced modulo the array's
+//                    size
+//
+//                  - The iterator points to the array, it does
+//                    not own it, so the samples can be changed
+//                    while iterating
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The fixed point phase
+//-------------------------------------------------------------------
+const int                                                   blFractionalPhaseBits = 32;
+const int64_t                                               blFractionalPhaseOne = int64_t(1) << blFractionalPhaseBits;
+const int64_t                                               blFractionalPhaseMask = blFractionalPhaseOne - 1;
+
+// Phases are added up before
+// being wrapped, so the sum of
+// two phases has to fit in 63 bits
+
+const size_t                                                blFractionalMaxSamples = size_t(1) << (62 - blFractionalPhaseBits);
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to multiply two non
+// negative numbers modulo another
+// one without overflowing
+//-------------------------------------------------------------------
+inline int64_t blMultiplyModulo(uint64_t a,
+                                uint64_t b,
+                                const uint64_t& modulo)
+{
+    uint64_t result = 0;
+
+    a %= modulo;
+
+    while(b > 0)
+    {
+        if(b & 1)
+            result = (result >= modulo - a ? result - (modulo - a) : result + a);
+
+        a = (a >= modulo - a ? a - (modulo - a) : a + a);
+        b >>= 1;
+    }
+
+    return static_cast<int64_t>(result);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Interpolators
+//
+// NOTE:    An interpolator tells how many
+//          samples it needs before (blLeftTaps)
+//          and after (blRightTaps) the sample
+//          at the phase's index, and its
+//          "interpolate" function gets a
+//          pointer to that sample and the
+//          fractional part of the phase
+//-------------------------------------------------------------------
+struct blLinearInterpolator
+{
+    static const size_t                                     blLeftTaps = 0;
+    static const size_t                                     blRightTaps = 1;
+
+    template<typename blDataType>
+    static blDataType                                       interpolate(const blDataType* samples,
+                                                                        const blDataType& fraction)
+    {
+        return samples[0] + fraction * (samples[1] - samples[0]);
+    }
+};
+
+struct blCubicInterpolator
+{
+    static const size_t                                     blLeftTaps = 1;
+    static const size_t                                     blRightTaps = 2;
+
+    template<typename blDataType>
+    static blDataType                                       interpolate(const blDataType* samples,
+                                                                        const blDataType& fraction)
+    {
+        const blDataType half = blDataType(0.5);
+
+        blDataType c1 = half * (samples[1] - samples[-1]);
+        blDataType c2 = samples[-1] - blDataType(2.5) * samples[0] + blDataType(2) * samples[1] - half * samples[2];
+        blDataType c3 = half * (samples[2] - samples[-1]) + blDataType(1.5) * (samples[0] - samples[1]);
+
+        return ((c3 * fraction + c2) * fraction + c1) * fraction + samples[0];
+    }
+};
+
+template<size_t blNumberOfTaps = 8,size_t blNumberOfPhases = 256>
+
+struct blSincInterpolator
+{
+    static_assert(blNumberOfTaps >= 2 && blNumberOfTaps % 2 == 0,
+                  "blSincInterpolator needs an even number of taps");
+
+    static const size_t                                     blLeftTaps = blNumberOfTaps / 2 - 1;
+    static const size_t                                     blRightTaps = blNumberOfTaps / 2;
+
+    template<typename blDataType>
+    static blDataType                                       interpolate(const blDataType* samples,
+                                                                        const blDataType& fraction)
+    {
+        const blDataType* table = getTable<blDataType>();
+
+        blDataType phase = fraction * blDataType(blNumberOfPhases);
+        size_t row = static_cast<size_t>(phase);
+        blDataType rowFraction = phase - blDataType(row);
+
+        const blDataType* coefficients0 = table + row * blNumberOfTaps;
+        const blDataType* coefficients1 = coefficients0 + blNumberOfTaps;
+
+        const blDataType* firstSample = samples - blLeftTaps;
+
+        blDataType sum0 = 0;
+        blDataType sum1 = 0;
+
+        for(size_t i = 0; i < blNumberOfTaps; ++i)
+        {
+            sum0 += coefficients0[i] * firstSample[i];
+            sum1 += coefficients1[i] * firstSample[i];
+        }
+
+        return sum0 + rowFraction * (sum1 - sum0);
+    }
+
+    // The table of Blackman windowed
+    // sinc coefficients, one row per
+    // phase plus one for the fraction
+    // 1.0 (each row normalized to a
+    // unit DC gain)
+
+    template<typename blDataType>
+    static const blDataType*                                getTable()
+    {
+        static const std::vector<blDataType> table = buildTable<blDataType>();
+
+        return table.data();
+    }
+
+    template<typename blDataType>
+    static std::vector<blDataType>                          buildTable()
+    {
+        const double pi = 3.14159265358979323846;
+        const double halfWidth = double(blNumberOfTaps) / 2.0;
+
+        std::vector<blDataType> table((blNumberOfPhases + 1) * blNumberOfTaps);
+
+        for(size_t row = 0; row <= blNumberOfPhases; ++row)
+        {
+            double fraction = double(row) / double(blNumberOfPhases);
+            double sum = 0;
+
+            std::vector<double> coefficients(blNumberOfTaps);
+
+            for(size_t i = 0; i < blNumberOfTaps; ++i)
+            {
+                double x = double(i) - double(blLeftTaps) - fraction;
+                double sinc = (x == 0 ? 1.0 : std::sin(pi * x) / (pi * x));
+                double windowPosition = (x + halfWidth) / (2.0 * halfWidth);
+                double window = 0.42 - 0.5 * std::cos(2.0 * pi * windowPosition) + 0.08 * std::cos(4.0 * pi * windowPosition);
+
+                coefficients[i] = sinc * window;
+                sum += coefficients[i];
+            }
+
+            for(size_t i = 0; i < blNumberOfTaps; ++i)
+                table[row * blNumberOfTaps + i] = blDataType(coefficients[i] / sum);
+        }
+
+        return table;
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The fractional iterator
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blInterpolatorType = blLinearInterpolator>
+
+class blFractionalIterator : public std::iterator<std::input_iterator_tag,
+                                                  blDataType,
+                                                  ptrdiff_t,
+                                                  const blDataType*,
+                                                  blDataType>
+{
+    static_assert(std::is_floating_point<blDataType>::value,
+                  "blFractionalIterator interpolates floating point samples");
+
+public: // Public typedefs
+
+    typedef blInterpolatorType                              blInterpolator;
+
+    static const size_t                                     blNumberOfTaps = blInterpolatorType::blLeftTaps + 1 + blInterpolatorType::blRightTaps;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blFractionalIterator() = default;
+
+    // Constructor from a raw
+    // array, a rate (in samples
+    // per step) and a starting
+    // position
+
+    blFractionalIterator(const blDataType* samples,
+                         const size_t& numberOfSamples,
+                         const double& rate = 1.0,
+                         const double& position = 0.0)
+                         : m_samples(samples),
+                           m_numberOfSamples(numberOfSamples),
+                           m_phaseLength(static_cast<int64_t>(numberOfSamples) << blFractionalPhaseBits)
+    {
+        assert(numberOfSamples < blFractionalMaxSamples);
+
+        this->setRate(rate);
+        this->setPosition(position);
+    }
+
+    // Constructor from any
+    // contiguous container
+
+    template<typename blContainerType,
+             typename = typename std::enable_if<!std::is_pointer<blContainerType>::value>::type>
+    blFractionalIterator(const blContainerType& container,
+                         const double& rate = 1.0,
+                         const double& position = 0.0)
+                         : blFractionalIterator(getDataPointer(container.cbegin()),
+                                                container.size(),
+                                                rate,
+                                                position)
+    {
+    }
+
+    // Copy constructor
+
+    blFractionalIterator(const blFractionalIterator<blDataType,blInterpolatorType>& iterator) = default;
+
+    // Destructor
+
+    ~blFractionalIterator(){}
+
+public: // Overloaded operators
+
+    blFractionalIterator<blDataType,blInterpolatorType>&    operator=(const blFractionalIterator<blDataType,blInterpolatorType>& iterator) = default;
+
+    bool                                                    operator==(const blFractionalIterator<blDataType,blInterpolatorType>& iterator)const{return (m_samples == iterator.m_samples && m_phase == iterator.m_phase);}
+    bool                                                    operator!=(const blFractionalIterator<blDataType,blInterpolatorType>& iterator)const{return !((*this) == iterator);}
+
+    // Dereferencing gives the
+    // interpolated sample
+
+    blDataType                                              operator*()const;
+
+    // Stepping adds the increment,
+    // while advancing adds it "n"
+    // times in O(log(n))
+
+    blFractionalIterator<blDataType,blInterpolatorType>&    operator++(){this->step();return (*this);}
+    blFractionalIterator<blDataType,blInterpolatorType>     operator++(int){auto temp(*this);this->step();return temp;}
+
+    blFractionalIterator<blDataType,blInterpolatorType>&    operator+=(const ptrdiff_t& numberOfSteps);
+    blFractionalIterator<blDataType,blInterpolatorType>     operator+(const ptrdiff_t& numberOfSteps)const{auto temp(*this);temp += numberOfSteps;return temp;}
+
+public: // Public functions
+
+    // Functions used to get/set
+    // the rate (samples per step)
+    // and the position
+
+    void                                                    setRate(const double& rate);
+    void                                                    setPosition(const double& position);
+
+    double                                                  getRate()const{return double(m_increment) / double(blFractionalPhaseOne);}
+    double                                                  getPosition()const{return double(m_phase) / double(blFractionalPhaseOne);}
+
+    // Functions used to get/set
+    // the raw fixed point phase
+    // and increment
+
+    void                                                    setPhase(const int64_t& phase){m_phase = this->wrap(phase);}
+    void                                                    setIncrement(const int64_t& increment){m_increment = (m_phaseLength > 0 ? increment % m_phaseLength : 0);}
+
+    const int64_t&                                          getPhase()const{return m_phase;}
+    const int64_t&                                          getIncrement()const{return m_increment;}
+
+    size_t                                                  getIndex()const{return static_cast<size_t>(m_phase >> blFractionalPhaseBits);}
+    blDataType                                              getFraction()const{return toFraction(m_phase);}
+
+    size_t                                                  size()const{return m_numberOfSamples;}
+    const blDataType*                                       data()const{return m_samples;}
+
+    // Functions used to render
+    // a block of interpolated
+    // samples, advancing the
+    // iterator past them
+
+    void                                                    render(blDataType* output,
+                                                                   const size_t& numberOfOutputSamples);
+
+    void                                                    render(blRawArrayWrapper<blDataType> output){this->render(output.begin().getPtr(),output.size());}
+
+private: // Private functions
+
+    void                                                    step()
+    {
+        m_phase = this->wrapOnce(m_phase + m_increment);
+    }
+
+    int64_t                                                 wrap(const int64_t& phase)const
+    {
+        if(m_phaseLength <= 0)
+            return 0;
+
+        int64_t wrappedPhase = phase % m_phaseLength;
+
+        return (wrappedPhase < 0 ? wrappedPhase + m_phaseLength : wrappedPhase);
+    }
+
+    int64_t                                                 wrapOnce(const int64_t& phase)const
+    {
+        if(phase >= m_phaseLength)
+            return phase - m_phaseLength;
+        else if(phase < 0)
+            return phase + m_phaseLength;
+        else
+            return phase;
+    }
+
+    // Function used to get the fraction
+    // of a phase, keeping only as many
+    // bits as the data type's mantissa,
+    // so it never rounds up to 1
+
+    static blDataType                                       toFraction(const int64_t& phase)
+    {
+        return blDataType((phase & blFractionalPhaseMask) >> blFractionBitsShift) * (blDataType(1) / blDataType(blFractionalPhaseOne >> blFractionBitsShift));
+    }
+
+    static const int                                        blFractionBitsShift = (std::numeric_limits<blDataType>::digits < blFractionalPhaseBits ?
+                                                                                   blFractionalPhaseBits - std::numeric_limits<blDataType>::digits : 0);
+
+    // Function used to interpolate
+    // at a phase whose samples wrap
+    // around the array's ends
+
+    blDataType                                              interpolateWrapped(const int64_t& phase)const;
+
+    // Function used to know how
+    // many steps can be taken from
+    // the phase, without any of the
+    // interpolated samples wrapping
+    // around the array's ends
+
+    size_t                                                  getNumberOfUnwrappedSteps(const size_t& maxNumberOfSteps)const;
+
+private: // Private variables
+
+    // The samples, the phase
+    // (in [0,m_phaseLength)) and
+    // the increment (in
+    // (-m_phaseLength,m_phaseLength))
+
+    const blDataType*                                       m_samples = nullptr;
+    size_t                                                  m_numberOfSamples = 0;
+    int64_t                                                 m_phaseLength = 0;
+
+    int64_t                                                 m_phase = 0;
+    int64_t                                                 m_increment = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline void blFractionalIterator<blDataType,blInterpolatorType>::setRate(const double& rate)
+{
+    this->setIncrement(static_cast<int64_t>(std::llround(std::fmod(rate,double(m_numberOfSamples > 0 ? m_numberOfSamples : 1)) * double(blFractionalPhaseOne))));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline void blFractionalIterator<blDataType,blInterpolatorType>::setPosition(const double& position)
+{
+    this->setPhase(static_cast<int64_t>(std::llround(std::fmod(position,double(m_numberOfSamples > 0 ? m_numberOfSamples : 1)) * double(blFractionalPhaseOne))));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline blFractionalIterator<blDataType,blInterpolatorType>&
+blFractionalIterator<blDataType,blInterpolatorType>::operator+=(const ptrdiff_t& numberOfSteps)
+{
+    if(m_phaseLength <= 0)
+        return (*this);
+
+    // The phase moves by
+    // (numberOfSteps * increment)
+    // modulo the phase length
+
+    uint64_t absoluteSteps = (numberOfSteps < 0 ? uint64_t(0) - uint64_t(numberOfSteps) : uint64_t(numberOfSteps));
+    uint64_t absoluteIncrement = (m_increment < 0 ? uint64_t(-m_increment) : uint64_t(m_increment));
+
+    int64_t movement = blMultiplyModulo(absoluteSteps,absoluteIncrement,uint64_t(m_phaseLength));
+
+    if((numberOfSteps < 0) != (m_increment < 0))
+        movement = -movement;
+
+    m_phase = this->wrapOnce(m_phase + movement);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline blDataType blFractionalIterator<blDataType,blInterpolatorType>::operator*()const
+{
+    size_t index = this->getIndex();
+
+    if(index >= blInterpolatorType::blLeftTaps && index + blInterpolatorType::blRightTaps < m_numberOfSamples)
+        return blInterpolatorType::interpolate(m_samples + index,toFraction(m_phase));
+
+    return this->interpolateWrapped(m_phase);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline blDataType blFractionalIterator<blDataType,blInterpolatorType>::interpolateWrapped(const int64_t& phase)const
+{
+    blDataType taps[blNumberOfTaps];
+
+    size_t index = static_cast<size_t>(phase >> blFractionalPhaseBits);
+
+    // The first tap's index, moved
+    // forward by whole arrays so it's
+    // never negative
+
+    size_t tapIndex = (index + m_numberOfSamples * (blInterpolatorType::blLeftTaps / m_numberOfSamples + 1) - blInterpolatorType::blLeftTaps) % m_numberOfSamples;
+
+    for(size_t i = 0; i < blNumberOfTaps; ++i)
+    {
+        taps[i] = m_samples[tapIndex];
+
+        if(++tapIndex == m_numberOfSamples)
+            tapIndex = 0;
+    }
+
+    return blInterpolatorType::interpolate(taps + blInterpolatorType::blLeftTaps,toFraction(phase));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline size_t blFractionalIterator<blDataType,blInterpolatorType>::getNumberOfUnwrappedSteps(const size_t& maxNumberOfSteps)const
+{
+    // The phases whose samples
+    // don't wrap are the ones in
+    // [minPhase,maxPhase)
+
+    if(m_numberOfSamples < blNumberOfTaps)
+        return 0;
+
+    int64_t minPhase = static_cast<int64_t>(blInterpolatorType::blLeftTaps) << blFractionalPhaseBits;
+    int64_t maxPhase = static_cast<int64_t>(m_numberOfSamples - blInterpolatorType::blRightTaps) << blFractionalPhaseBits;
+
+    if(m_phase < minPhase || m_phase >= maxPhase)
+        return 0;
+
+    uint64_t numberOfSteps;
+
+    if(m_increment > 0)
+        numberOfSteps = uint64_t(maxPhase - 1 - m_phase) / uint64_t(m_increment) + 1;
+    else if(m_increment < 0)
+        numberOfSteps = uint64_t(m_phase - minPhase) / uint64_t(-m_increment) + 1;
+    else
+        numberOfSteps = maxNumberOfSteps;
+
+    return (numberOfSteps < maxNumberOfSteps ? static_cast<size_t>(numberOfSteps) : maxNumberOfSteps);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blInterpolatorType>
+inline void blFractionalIterator<blDataType,blInterpolatorType>::render(blDataType* output,
+                                                                       const size_t& numberOfOutputSamples)
+{
+    if(m_phaseLength <= 0)
+        return;
+
+    size_t i = 0;
+
+    while(i < numberOfOutputSamples)
+    {
+        size_t numberOfSteps = this->getNumberOfUnwrappedSteps(numberOfOutputSamples - i);
+
+        if(numberOfSteps == 0)
+        {
+            // A sample whose interpolation
+            // wraps around the array's ends
+
+            output[i] = this->interpolateWrapped(m_phase);
+            this->step();
+            ++i;
+
+            continue;
+        }
+
+        // A run of samples that don't
+        // wrap, interpolated without
+        // any branches
+
+        const blDataType* samples = m_samples;
+        const int64_t increment = m_increment;
+        int64_t phase = m_phase;
+
+        blDataType* runOutput = output + i;
+
+        for(size_t j = 0; j < numberOfSteps; ++j)
+        {
+            runOutput[j] = blInterpolatorType::interpolate(samples + (phase >> blFractionalPhaseBits),toFraction(phase));
+            phase += increment;
+        }
+
+        m_phase = this->wrapOnce(phase);
+        i += numberOfSteps;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to get a fractional
+// iterator over a container
+//-------------------------------------------------------------------
+template<typename blInterpolatorType = blLinearInterpolator,
+         typename blContainerType>
+
+inline auto getFractionalIterator(const blContainerType& container,
+                                  const double& rate = 1.0,
+                                  const double& position = 0.0)
+->blFractionalIterator<typename std::remove_const<typename std::remove_pointer<decltype(getDataPointer(container.cbegin()))>::type>::type,blInterpolatorType>
+{
+    return blFractionalIterator<typename std::remove_const<typename std::remove_pointer<decltype(getDataPointer(container.cbegin()))>::type>::type,blInterpolatorType>(container,rate,position);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_FRACTIONALITERATOR_HPP
@@ -0,0 +1,452 @@
+#ifndef BL_GENERATOR_HPP
+#define BL_GENERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blGenerator.hpp
+// CLASS:           blGenerator
+// BASE CLASS:      None
+//
+// PURPOSE:         A c++20 coroutine type producing a lazy sequence
+//                  of values (decoded records, synthetic signals and
+//                  such) without first copying them into an array.
+//
+//                  - The coroutine "co_yield"s its values one at a
+//                    time, but they are written into a block held
+//                    by the coroutine and it is only suspended
+//                    when the block is full (or when it ends)
+//
+//                  - The consumer takes whole blocks with
+//                    next_block, as blRawArrayWrappers, so it can
+//                    run the library's (vectorized) algorithms on
+//                    each block, or walks the values one by one
+//                    with the generator's input iterators
+//
+//                  - The coroutine frame is allocated through the
+//                    allocator passed as the coroutine's first
+//                    arguments (std::allocator_arg, allocator),
+//                    with std::allocator used otherwise
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - coroutine -- Only compiled when the compiler
+//                                 supports c++20 coroutines
+//                  - blRawArrayWrapper -- The blocks
+//                  - blSimdAlgorithms -- Counting the values
+//
+// NOTES:           - The values have to be default constructible
+//                    and assignable, since the block is an array
+//
+//                  - A block is only valid until the next block
+//                    is taken
+//
+//                  - Compilers can elide the frame's allocation
+//                    altogether when the generator doesn't outlive
+//                    the function creating it, in which case the
+//                    allocator is never called
+//
+//                  - Exceptions thrown by the coroutine are
+//                    rethrown to the consumer by next_block
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+#if defined(BL_COROUTINES_ENABLED)
+
+
+//-------------------------------------------------------------------
+// Default number of values
+// per block
+//-------------------------------------------------------------------
+const size_t                                                blGeneratorBlockSize = 256;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to allocate coroutine
+// frames through an allocator
+//
+// NOTE:    A copy of the allocator and the
+//          function used to deallocate
+//          the frame are stored right
+//          after the frame, so the frame
+//          can be given back knowing only
+//          its address and size
+//-------------------------------------------------------------------
+typedef void (*blCoroutineFrameDeallocator)(void* frame,const size_t& frameSize);
+
+struct alignas(std::max_align_t) blCoroutineFrameChunk
+{
+    unsigned char                                           m_bytes[alignof(std::max_align_t)];
+};
+
+template<typename blAllocatorType>
+struct blCoroutineFrameTail
+{
+    typedef typename std::allocator_traits<blAllocatorType>::template rebind_alloc<blCoroutineFrameChunk>    blChunkAllocatorType;
+
+    blCoroutineFrameDeallocator                             m_deallocator;
+    blChunkAllocatorType                                    m_allocator;
+};
+
+inline size_t getCoroutineFrameTailOffset(const size_t& frameSize)
+{
+    return (frameSize + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+template<typename blAllocatorType>
+inline size_t getCoroutineFrameNumberOfChunks(const size_t& frameSize)
+{
+    return (getCoroutineFrameTailOffset(frameSize) + sizeof(blCoroutineFrameTail<blAllocatorType>) + sizeof(blCoroutineFrameChunk) - 1) / sizeof(blCoroutineFrameChunk);
+}
+
+template<typename blAllocatorType>
+inline void deallocateCoroutineFrame(void* frame,const size_t& frameSize)
+{
+    typedef blCoroutineFrameTail<blAllocatorType>           blTailType;
+
+    blTailType* tail = reinterpret_cast<blTailType*>(static_cast<unsigned char*>(frame) + getCoroutineFrameTailOffset(frameSize));
+
+    typename blTailType::blChunkAllocatorType allocator(std::move(tail->m_allocator));
+
+    tail->~blTailType();
+
+    std::allocator_traits<typename blTailType::blChunkAllocatorType>::deallocate(allocator,
+                                                                                 static_cast<blCoroutineFrameChunk*>(frame),
+                                                                                 getCoroutineFrameNumberOfChunks<blAllocatorType>(frameSize));
+}
+
+template<typename blAllocatorType>
+inline void* allocateCoroutineFrame(const size_t& frameSize,const blAllocatorType& allocator)
+{
+    typedef blCoroutineFrameTail<blAllocatorType>           blTailType;
+
+    typename blTailType::blChunkAllocatorType chunkAllocator(allocator);
+
+    void* frame = std::allocator_traits<typename blTailType::blChunkAllocatorType>::allocate(chunkAllocator,
+                                                                                             getCoroutineFrameNumberOfChunks<blAllocatorType>(frameSize));
+
+    new (static_cast<unsigned char*>(frame) + getCoroutineFrameTailOffset(frameSize)) blTailType{&deallocateCoroutineFrame<blAllocatorType>,
+                                                                                                   std::move(chunkAllocator)};
+
+    return frame;
+}
+
+inline void deallocateCoroutineFrame(void* frame,const size_t& frameSize)
+{
+    blCoroutineFrameDeallocator deallocator;
+
+    std::memcpy(&deallocator,static_cast<unsigned char*>(frame) + getCoroutineFrameTailOffset(frameSize),sizeof(deallocator));
+
+    deallocator(frame,frameSize);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The generator
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize = blGeneratorBlockSize>
+
+class blGenerator
+{
+    static_assert(blBlockSize > 0,"blGenerator blocks can't be empty");
+
+public: // Public typedefs
+
+    class                                                   promise_type;
+    class                                                   iterator;
+
+    typedef std::coroutine_handle<promise_type>             blHandleType;
+    typedef blRawArrayWrapper<const blDataType>             blBlockType;
+
+    // Awaiter suspending the
+    // coroutine only when its
+    // block is full
+
+    struct blBlockAwaiter
+    {
+        bool                                                await_ready()const noexcept{return !m_isBlockFull;}
+        void                                                await_suspend(blHandleType)const noexcept{}
+        void                                                await_resume()const noexcept{}
+
+        bool                                                m_isBlockFull;
+    };
+
+    // The coroutine's promise
+
+    class promise_type
+    {
+    public:
+
+        blGenerator<blDataType,blBlockSize>                 get_return_object(){return blGenerator<blDataType,blBlockSize>(blHandleType::from_promise(*this));}
+
+        std::suspend_always                                 initial_suspend()const noexcept{return {};}
+        std::suspend_always                                 final_suspend()const noexcept{return {};}
+
+        blBlockAwaiter                                      yield_value(const blDataType& value)
+        {
+            m_block[m_blockSize++] = value;
+            return blBlockAwaiter{m_blockSize == blBlockSize};
+        }
+
+        blBlockAwaiter                                      yield_value(blDataType&& value)
+        {
+            m_block[m_blockSize++] = std::move(value);
+            return blBlockAwaiter{m_blockSize == blBlockSize};
+        }
+
+        void                                                return_void()const noexcept{}
+        void                                                unhandled_exception(){m_exception = std::current_exception();}
+
+        // Frame allocation, with
+        // std::allocator or with the
+        // allocator passed after
+        // std::allocator_arg (also
+        // for member coroutines)
+
+        static void*                                        operator new(size_t frameSize)
+        {
+            return allocateCoroutineFrame(frameSize,std::allocator<blCoroutineFrameChunk>());
+        }
+
+        template<typename blAllocatorType,typename... blArgumentTypes>
+        static void*                                        operator new(size_t frameSize,
+                                                                         std::allocator_arg_t,
+                                                                         const blAllocatorType& allocator,
+                                                                         const blArgumentTypes&...)
+        {
+            return allocateCoroutineFrame(frameSize,allocator);
+        }
+
+        template<typename blObjectType,typename blAllocatorType,typename... blArgumentTypes>
+        static void*                                        operator new(size_t frameSize,
+                                                                         const blObjectType&,
+                                                                         std::allocator_arg_t,
+                                                                         const blAllocatorType& allocator,
+                                                                         const blArgumentTypes&...)
+        {
+            return allocateCoroutineFrame(frameSize,allocator);
+        }
+
+        static void                                         operator delete(void* frame,size_t frameSize)
+        {
+            deallocateCoroutineFrame(frame,frameSize);
+        }
+
+    private:
+
+        friend class blGenerator<blDataType,blBlockSize>;
+
+        blDataType                                          m_block[blBlockSize];
+        size_t                                              m_blockSize = 0;
+        std::exception_ptr                                  m_exception;
+    };
+
+    // Input iterator walking
+    // the values one by one,
+    // block after block
+
+    class iterator
+    {
+    public:
+
+        typedef std::input_iterator_tag                     iterator_category;
+        typedef blDataType                                  value_type;
+        typedef ptrdiff_t                                   difference_type;
+        typedef const blDataType*                           pointer;
+        typedef const blDataType&                           reference;
+
+        iterator() : m_generator(nullptr),m_index(0)
+        {
+        }
+
+        explicit iterator(blGenerator<blDataType,blBlockSize>* generator) : m_generator(generator),m_index(0)
+        {
+            this->fetchBlock();
+        }
+
+        const blDataType&                                   operator*()const{return m_block[m_index];}
+        const blDataType*                                   operator->()const{return &m_block[m_index];}
+
+        iterator&                                           operator++()
+        {
+            if(++m_index == m_block.size())
+                this->fetchBlock();
+
+            return (*this);
+        }
+
+        void                                                operator++(int){++(*this);}
+
+        bool                                                operator==(const iterator& iter)const{return (m_generator == iter.m_generator && m_index == iter.m_index);}
+        bool                                                operator!=(const iterator& iter)const{return !((*this) == iter);}
+
+    private:
+
+        // Function used to take the
+        // next block, the iterator
+        // becomes the end iterator
+        // once the generator is done
+
+        void                                                fetchBlock()
+        {
+            m_block = m_generator->next_block();
+            m_index = 0;
+
+            if(m_block.size() == 0)
+                m_generator = nullptr;
+        }
+
+        blGenerator<blDataType,blBlockSize>*                m_generator;
+        blBlockType                                         m_block;
+        size_t                                              m_index;
+    };
+
+public: // Constructors and destructors
+
+    blGenerator() : m_handle(nullptr)
+    {
+    }
+
+    explicit blGenerator(blHandleType handle) : m_handle(handle)
+    {
+    }
+
+    blGenerator(const blGenerator<blDataType,blBlockSize>&) = delete;
+
+    blGenerator(blGenerator<blDataType,blBlockSize>&& generator) noexcept : m_handle(generator.m_handle)
+    {
+        generator.m_handle = nullptr;
+    }
+
+    ~blGenerator()
+    {
+        if(m_handle)
+            m_handle.destroy();
+    }
+
+public: // Assignment operators
+
+    blGenerator<blDataType,blBlockSize>&                    operator=(const blGenerator<blDataType,blBlockSize>&) = delete;
+
+    blGenerator<blDataType,blBlockSize>&                    operator=(blGenerator<blDataType,blBlockSize>&& generator) noexcept
+    {
+        if(this != &generator)
+        {
+            if(m_handle)
+                m_handle.destroy();
+
+            m_handle = generator.m_handle;
+            generator.m_handle = nullptr;
+        }
+
+        return (*this);
+    }
+
+public: // Public functions
+
+    // Function used to run the
+    // coroutine until it fills
+    // its next block (or ends),
+    // the block is empty once
+    // the coroutine is done
+
+    blBlockType                                             next_block()
+    {
+        if(!m_handle || m_handle.done())
+            return blBlockType();
+
+        promise_type& promise = m_handle.promise();
+
+        promise.m_blockSize = 0;
+
+        m_handle.resume();
+
+        if(promise.m_exception)
+            std::rethrow_exception(std::exchange(promise.m_exception,nullptr));
+
+        if(promise.m_blockSize == 0)
+            return blBlockType();
+
+        return blBlockType(promise.m_block,promise.m_blockSize);
+    }
+
+    blBlockType                                             take_batch(){return this->next_block();}
+
+    // Function used to know
+    // whether the coroutine
+    // is done
+
+    bool                                                    done()const{return (!m_handle || m_handle.done());}
+
+    // Functions used to walk
+    // the values one by one
+
+    iterator                                                begin(){return iterator(this);}
+    iterator                                                end(){return iterator();}
+
+private: // Private variables
+
+    blHandleType                                            m_handle;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to consume a generator
+// block by block, calling a functor
+// with each block
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize,typename blFunctorType>
+inline void blForEachBlock(blGenerator<blDataType,blBlockSize>& generator,
+                           blFunctorType&& functor)
+{
+    for(auto block = generator.next_block(); block.size() > 0; block = generator.next_block())
+        functor(block);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Counting algorithms consuming a
+// generator, running the vectorized
+// counts on each block
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize,typename blPredicateType>
+inline size_t blCountIf(blGenerator<blDataType,blBlockSize>& generator,
+                        const blPredicateType& predicate)
+{
+    size_t numberOfElements = 0;
+
+    blForEachBlock(generator,[&](const typename blGenerator<blDataType,blBlockSize>::blBlockType& block)
+    {
+        const blDataType* begin = block.cbegin().getPtr();
+
+        numberOfElements += blCountIf(begin,begin + block.size(),predicate);
+    });
+
+    return numberOfElements;
+}
+
+template<typename blDataType,size_t blBlockSize>
+inline size_t blCount(blGenerator<blDataType,blBlockSize>& generator,
+                      const blDataType& value)
+{
+    return blCountIf(generator,blIsEqualTo<blDataType>(value));
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_COROUTINES_ENABLED
+
+
+#endif // BL_GENERATOR_HPP
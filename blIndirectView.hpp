@@ -0,0 +1,479 @@
+#ifndef BL_INDIRECTVIEW_HPP
+#define BL_INDIRECTVIEW_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blIndirectView.hpp
+// CLASS:           blIndirectIterator
+//                  blIndirectView
+// BASE CLASS:      None
+//
+// PURPOSE:         Tools used to access an array through an array
+//                  of indices (sorted permutations, selection
+//                  vectors and such):
+//
+//                  - blIndirectView -- A view of the elements
+//                                      data[indices[i]], whose
+//                                      iterators prefetch the
+//                                      elements a few indices
+//                                      ahead, so the smart iterators
+//                                      can walk it like any container
+//
+//                  - blGather -- Copies data[indices[i]] into a
+//                                contiguous buffer, with AVX2 gathers
+//                                for 4 byte elements (int32, float)
+//                                when the cpu supports them
+//
+//                  - blScatter -- Copies a contiguous buffer into
+//                                 data[indices[i]]
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper
+//                  - blSimdAlgorithms -- The cpu's instruction set
+//                  - immintrin.h -- AVX2 intrinsics
+//
+// NOTES:           - Indices are not checked against the data's size
+//
+//                  - Like std::copy, blScatter with repeated indices
+//                    leaves the last value written at each index
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// How many indices ahead
+// the elements get prefetched
+//-------------------------------------------------------------------
+const size_t                                                blIndirectPrefetchDistance = 16;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to prefetch an
+// element for reading or writing
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline void blPrefetchForRead(const blDataType* ptr)
+{
+    #if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr,0);
+    #else
+        (void)ptr;
+    #endif
+}
+
+template<typename blDataType>
+inline void blPrefetchForWrite(blDataType* ptr)
+{
+    #if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr,1);
+    #else
+        (void)ptr;
+    #endif
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Random access iterator walking
+// an array of indices and pointing
+// to the elements they index
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+
+class blIndirectIterator : public std::iterator<std::random_access_iterator_tag,
+                                                typename std::remove_const<blDataType>::type,
+                                                ptrdiff_t,
+                                                blDataType*,
+                                                blDataType&>
+{
+public:
+
+    blIndirectIterator(blDataType* data = nullptr,
+                       const blIndexType* index = nullptr,
+                       const blIndexType* indicesEnd = nullptr)
+                       : m_data(data),
+                         m_index(index),
+                         m_indicesEnd(indicesEnd)
+    {
+    }
+
+    blIndirectIterator(const blIndirectIterator<blDataType,blIndexType>& iterator) = default;
+    ~blIndirectIterator(){}
+
+    // Conversion from an iterator
+    // to non-const data into an
+    // iterator to const data
+
+    template<typename blOtherDataType,
+             typename = typename std::enable_if<std::is_convertible<blOtherDataType*,blDataType*>::value>::type>
+    blIndirectIterator(const blIndirectIterator<blOtherDataType,blIndexType>& iterator)
+                       : m_data(iterator.getData()),
+                         m_index(iterator.getIndexPtr()),
+                         m_indicesEnd(iterator.getIndicesEnd())
+    {
+    }
+
+    blIndirectIterator<blDataType,blIndexType>&             operator=(const blIndirectIterator<blDataType,blIndexType>& iterator) = default;
+
+    bool                                                    operator==(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index == iterator.getIndexPtr());}
+    bool                                                    operator!=(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index != iterator.getIndexPtr());}
+    bool                                                    operator<(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index < iterator.getIndexPtr());}
+    bool                                                    operator>(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index > iterator.getIndexPtr());}
+    bool                                                    operator<=(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index <= iterator.getIndexPtr());}
+    bool                                                    operator>=(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index >= iterator.getIndexPtr());}
+
+    // Stepping forward prefetches
+    // the element indexed a few
+    // indices ahead
+
+    blIndirectIterator<blDataType,blIndexType>&             operator++()
+    {
+        ++m_index;
+
+        if(m_indicesEnd - m_index > static_cast<ptrdiff_t>(blIndirectPrefetchDistance))
+            blPrefetchForRead(m_data + m_index[blIndirectPrefetchDistance]);
+
+        return (*this);
+    }
+
+    blIndirectIterator<blDataType,blIndexType>&             operator--(){--m_index;return (*this);}
+    blIndirectIterator<blDataType,blIndexType>              operator++(int){auto temp(*this);++(*this);return temp;}
+    blIndirectIterator<blDataType,blIndexType>              operator--(int){auto temp(*this);--m_index;return temp;}
+
+    blIndirectIterator<blDataType,blIndexType>&             operator+=(const ptrdiff_t& movement){m_index += movement;return (*this);}
+    blIndirectIterator<blDataType,blIndexType>&             operator-=(const ptrdiff_t& movement){m_index -= movement;return (*this);}
+    blIndirectIterator<blDataType,blIndexType>              operator+(const ptrdiff_t& movement)const{auto temp(*this);temp += movement;return temp;}
+    blIndirectIterator<blDataType,blIndexType>              operator-(const ptrdiff_t& movement)const{auto temp(*this);temp -= movement;return temp;}
+
+    ptrdiff_t                                               operator-(const blIndirectIterator<blDataType,blIndexType>& iterator)const{return (m_index - iterator.getIndexPtr());}
+
+    blDataType&                                             operator*()const{return m_data[*m_index];}
+    blDataType*                                             operator->()const{return &m_data[*m_index];}
+    blDataType&                                             operator[](const ptrdiff_t& offset)const{return m_data[m_index[offset]];}
+
+    blDataType*                                             getData()const{return m_data;}
+    const blIndexType*                                      getIndexPtr()const{return m_index;}
+    const blIndexType*                                      getIndicesEnd()const{return m_indicesEnd;}
+
+private:
+
+    blDataType*                                             m_data;
+    const blIndexType*                                      m_index;
+    const blIndexType*                                      m_indicesEnd;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// View of the elements of an array
+// picked by an array of indices, it
+// does not own (nor delete) either
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType = size_t>
+
+class blIndirectView
+{
+    static_assert(std::is_integral<blIndexType>::value,"blIndirectView indices have to be integers");
+
+public: // Public typedefs
+
+    typedef blDataType                                              value_type;
+
+    typedef blIndirectIterator<blDataType,blIndexType>              iterator;
+    typedef blIndirectIterator<const blDataType,blIndexType>        const_iterator;
+
+    typedef std::reverse_iterator<iterator>                         reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>                   const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blIndirectView() : m_data(nullptr),m_indices(nullptr),m_numberOfIndices(0)
+    {
+    }
+
+    // Constructor using
+    // raw arrays
+
+    blIndirectView(blDataType* data,
+                   const blIndexType* indices,
+                   const size_t& numberOfIndices)
+                   : m_data(data),
+                     m_indices(indices),
+                     m_numberOfIndices(numberOfIndices)
+    {
+    }
+
+    // Constructor using
+    // wrapped arrays
+
+    blIndirectView(blRawArrayWrapper<blDataType> data,
+                   blRawArrayWrapper<const blIndexType> indices)
+                   : m_data(data.begin().getPtr()),
+                     m_indices(indices.cbegin().getPtr()),
+                     m_numberOfIndices(indices.size())
+    {
+    }
+
+    ~blIndirectView()
+    {
+    }
+
+public: // Public functions
+
+    // Element access
+    // functions
+
+    blDataType&                                             operator[](const size_t& i){return m_data[m_indices[i]];}
+    const blDataType&                                       operator[](const size_t& i)const{return m_data[m_indices[i]];}
+
+    // Functions used
+    // to return the
+    // number of indices
+
+    size_t                                                  length()const{return m_numberOfIndices;}
+    size_t                                                  size()const{return m_numberOfIndices;}
+    size_t                                                  max_size()const{return m_numberOfIndices;}
+    bool                                                    empty()const{return (m_numberOfIndices == 0);}
+
+    // Functions used to
+    // get the arrays
+
+    blDataType*                                             getData()const{return m_data;}
+    const blIndexType*                                      getIndices()const{return m_indices;}
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(m_data,m_indices,m_indices + m_numberOfIndices);}
+    iterator                                                end(){return iterator(m_data,m_indices + m_numberOfIndices,m_indices + m_numberOfIndices);}
+    const_iterator                                          cbegin()const{return const_iterator(m_data,m_indices,m_indices + m_numberOfIndices);}
+    const_iterator                                          cend()const{return const_iterator(m_data,m_indices + m_numberOfIndices,m_indices + m_numberOfIndices);}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(end());}
+    reverse_iterator                                        rend(){return reverse_iterator(begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(cbegin());}
+
+private: // Private variables
+
+    blDataType*                                             m_data;
+    const blIndexType*                                      m_indices;
+    size_t                                                  m_numberOfIndices;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to easily get
+// the indirect view of wrapped
+// arrays
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+inline blIndirectView<blDataType,blIndexType> getIndirectView(blRawArrayWrapper<blDataType> data,
+                                                              blRawArrayWrapper<const blIndexType> indices)
+{
+    return blIndirectView<blDataType,blIndexType>(data,indices);
+}
+
+template<typename blDataType,typename blIndexType>
+inline blIndirectView<blDataType,blIndexType> getIndirectView(blRawArrayWrapper<blDataType> data,
+                                                              blRawArrayWrapper<blIndexType> indices)
+{
+    return blIndirectView<blDataType,blIndexType>(data.begin().getPtr(),indices.begin().getPtr(),indices.size());
+}
+//-------------------------------------------------------------------
+
+
+#if defined(BL_SIMD_ENABLED)
+
+
+//-------------------------------------------------------------------
+// The AVX2 gather kernel of 4 byte
+// elements, it returns how many
+// elements it gathered (the rest is
+// left to the plain loop)
+//
+// NOTE:    - 32-bit gathers take signed
+//            indices, so unsigned 32-bit
+//            indices are widened to 64 bits
+//
+//          - Gathering 8 byte elements
+//            is no faster than the plain
+//            loop, so it's left to it
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+__attribute__((target("avx2"))) inline size_t blGatherAVX2(const blDataType* data,
+                                                           const blIndexType* indices,
+                                                           const size_t& numberOfIndices,
+                                                           blDataType* output)
+{
+    const bool isIndex32 = (sizeof(blIndexType) == 4);
+    const bool isIndexSigned = std::is_signed<blIndexType>::value;
+
+    size_t i = 0;
+
+    if(isIndex32 && isIndexSigned)
+    {
+        for(; i + 8 <= numberOfIndices; i += 8)
+        {
+            __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),_mm256_i32gather_epi32(reinterpret_cast<const int*>(data),offsets,4));
+        }
+    }
+    else if(isIndex32)
+    {
+        for(; i + 4 <= numberOfIndices; i += 4)
+        {
+            __m256i offsets = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),_mm256_i64gather_epi32(reinterpret_cast<const int*>(data),offsets,4));
+        }
+    }
+    else
+    {
+        for(; i + 4 <= numberOfIndices; i += 4)
+        {
+            __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i),_mm256_i64gather_epi32(reinterpret_cast<const int*>(data),offsets,4));
+        }
+    }
+
+    return i;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SIMD_ENABLED
+
+
+//-------------------------------------------------------------------
+// Whether the gathers of a type
+// can use the AVX2 kernels
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+struct blIsGatherType : std::integral_constant<bool,
+                                               std::is_trivially_copyable<blDataType>::value &&
+                                               sizeof(blDataType) == 4 &&
+                                               std::is_integral<blIndexType>::value &&
+                                               (sizeof(blIndexType) == 4 || sizeof(blIndexType) == 8)>
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to pick
+// the gather kernel
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+inline size_t blGatherVectorized(const blDataType* data,
+                                 const blIndexType* indices,
+                                 const size_t& numberOfIndices,
+                                 blDataType* output,
+                                 std::true_type)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        if(blGetSimdLevel() >= blSimdAVX2)
+            return blGatherAVX2(data,indices,numberOfIndices,output);
+
+    #endif
+
+    return 0;
+}
+
+template<typename blDataType,typename blIndexType>
+inline size_t blGatherVectorized(const blDataType*,
+                                 const blIndexType*,
+                                 const size_t&,
+                                 blDataType*,
+                                 std::false_type)
+{
+    return 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to copy the elements
+// data[indices[i]] into output[i]
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+inline void blGather(const blDataType* data,
+                     const blIndexType* indices,
+                     const size_t& numberOfIndices,
+                     blDataType* output)
+{
+    size_t i = blGatherVectorized(data,
+                                  indices,
+                                  numberOfIndices,
+                                  output,
+                                  blIsGatherType<blDataType,blIndexType>());
+
+    for(; i < numberOfIndices; ++i)
+    {
+        if(i + blIndirectPrefetchDistance < numberOfIndices)
+            blPrefetchForRead(data + indices[i + blIndirectPrefetchDistance]);
+
+        output[i] = data[indices[i]];
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to copy the elements
+// values[i] into data[indices[i]]
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+inline void blScatter(const blDataType* values,
+                      const blIndexType* indices,
+                      const size_t& numberOfIndices,
+                      blDataType* data)
+{
+    for(size_t i = 0; i < numberOfIndices; ++i)
+    {
+        if(i + blIndirectPrefetchDistance < numberOfIndices)
+            blPrefetchForWrite(data + indices[i + blIndirectPrefetchDistance]);
+
+        data[indices[i]] = values[i];
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The same functions working with
+// an indirect view, gathering into
+// (or scattering from) a buffer
+// holding an element per index
+//-------------------------------------------------------------------
+template<typename blDataType,typename blIndexType>
+inline void blGather(const blIndirectView<blDataType,blIndexType>& view,
+                     typename std::remove_const<blDataType>::type* output)
+{
+    blGather(static_cast<const blDataType*>(view.getData()),view.getIndices(),view.size(),output);
+}
+
+template<typename blDataType,typename blIndexType>
+inline void blScatter(const blDataType* values,
+                      blIndirectView<blDataType,blIndexType>& view)
+{
+    blScatter(values,view.getIndices(),view.size(),view.getData());
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_INDIRECTVIEW_HPP
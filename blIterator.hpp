@@ -17,6 +17,16 @@
 //                  while moving forward, be made into a reverse iterator
 //                  or much more.
 //
+//                  An optional instrumentation policy can be
+//                  specified to count how the iterator moves
+//                  (see blIteratorInstrumentation.hpp).
+//
+//                  When the underlying iterator is not random
+//                  access, the iterator keeps its distances from
+//                  the begin and to the end up to date as it
+//                  moves, so advancing, measuring distances and
+//                  comparing against begin/end stay O(1) per step.
+//
 // AUTHOR:          Vincenzo Barbato
 //                  http://www.barbatolabs.com
 //                  navyenzo@gmail.com
@@ -34,27 +44,114 @@
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// The position of a blIterator
+//
+// NOTE:    When the underlying iterator is
+//          random access, the distances from
+//          begin and to end are calculated
+//          when needed, so nothing is stored.
+//          For any other iterator (for example
+//          std::list or std::map iterators)
+//          std::distance would walk the whole
+//          container on every advance, so the
+//          distances are stored and updated
+//          incrementally instead.
+//-------------------------------------------------------------------
+template<bool blIsPositionTracked>
+
+class blIteratorPosition
+{
+};
+
+template<>
+
+class blIteratorPosition<true>
+{
+protected:
+
+    ptrdiff_t                                                       m_distanceFromBeginToIter = 0;
+    ptrdiff_t                                                       m_distanceFromIterToEnd = 0;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The state of a blIterator's
+// advance functor
+//
+// NOTE:    Stateless advance functors
+//          (blNoAdvanceState) get an
+//          empty base, so nothing is
+//          stored
+//-------------------------------------------------------------------
+template<typename blAdvanceStateType>
+
+class blIteratorAdvanceState
+{
+public:
+
+    const blAdvanceStateType&                                       getAdvanceState()const{return m_advanceState;}
+
+protected:
+
+    blAdvanceStateType&                                             advanceState(){return m_advanceState;}
+    void                                                            resetAdvanceState(){m_advanceState = blAdvanceStateType();}
+
+    blAdvanceStateType                                              m_advanceState = blAdvanceStateType();
+};
+
+template<>
+
+class blIteratorAdvanceState<blNoAdvanceState>
+{
+public:
+
+    blNoAdvanceState                                                getAdvanceState()const{return blNoAdvanceState();}
+
+protected:
+
+    blNoAdvanceState                                                advanceState()const{return blNoAdvanceState();}
+    void                                                            resetAdvanceState(){}
+};
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 template<typename blContainerType,
          typename blAdvanceDistanceFunctorType,
-         typename blBeginEndFunctorType>
+         typename blBeginEndFunctorType,
+         typename blInstrumentationType = blNoInstrumentation>
 
 class blIterator : public std::iterator< std::random_access_iterator_tag,
                                          typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::value_type,
                                          typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::difference_type,
                                          typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::pointer,
-                                         typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::reference >
+                                         typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::reference >,
+                   private blIteratorPosition<!std::is_base_of<std::random_access_iterator_tag,
+                                                               typename std::iterator_traits<decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))>::iterator_category>::value>,
+                   private blIteratorAdvanceState<typename blAdvanceStateOf<blAdvanceDistanceFunctorType>::type>
 {
 public: // Public typedefs
 
     typedef typename std::shared_ptr<blContainerType>                                           blContainerPtr;
 
-    typedef typename std::iterator_traits<typename blContainerType::iterator>::value_type       blDataType;
-    typedef typename std::iterator_traits<typename blContainerType::iterator>::pointer          blDataTypePtr;
-    typedef typename std::iterator_traits<typename blContainerType::iterator>::reference        blDataTypeRef;
-
     typedef decltype(blBeginEndFunctorType::begin(std::declval<blContainerType&>()))            iterator;
 
+    typedef typename std::iterator_traits<iterator>::value_type                                 blDataType;
+    typedef typename std::iterator_traits<iterator>::pointer                                    blDataTypePtr;
+    typedef typename std::iterator_traits<iterator>::reference                                  blDataTypeRef;
+
+    typedef typename std::iterator_traits<iterator>::iterator_category                          blIteratorCategory;
+
+    typedef std::integral_constant<bool,
+                                   !std::is_base_of<std::random_access_iterator_tag,
+                                                    blIteratorCategory>::value>                 blIsPositionTracked;
+
+    typedef blRawArrayWrapper<typename std::remove_reference<typename std::iterator_traits<iterator>::reference>::type>   blBatchType;
+
+    typedef typename blAdvanceStateOf<blAdvanceDistanceFunctorType>::type                      blAdvanceStateType;
+
 private: // Private variables
 
     // The iterator
@@ -63,11 +160,24 @@ private: // Private variables
 
     iterator                                                        m_ptr;
 
-    // The raw pointer
-    // to the dat Container
+    // The shared pointer
+    // to the Container
+    //
+    // NOTE:    It is left empty by
+    //          borrowed iterators, so
+    //          copying them never
+    //          touches the shared
+    //          pointer's reference
+    //          count
 
     blContainerPtr                                                  m_containerPtr;
 
+    // The raw pointer to
+    // the Container, used
+    // for every access
+
+    blContainerType*                                                m_rawContainerPtr = nullptr;
+
 public: // Constructors and destructors
 
     // Default constructors
@@ -79,9 +189,10 @@ public: // Constructors and destructors
     blIterator(blContainerType& container)
     {
         m_containerPtr = get_shared_ptr(container);
+        m_rawContainerPtr = m_containerPtr.get();
 
-        if(m_containerPtr)
-            m_ptr = blBeginEndFunctorType::begin(*m_containerPtr);
+        if(m_rawContainerPtr)
+            this->moveToBegin();
     }
 
     // Construct from container
@@ -90,9 +201,10 @@ public: // Constructors and destructors
     blIterator(blContainerType* containerPtr)
     {
         m_containerPtr = get_shared_ptr(containerPtr);
+        m_rawContainerPtr = m_containerPtr.get();
 
-        if(m_containerPtr)
-            m_ptr = blBeginEndFunctorType::begin(*m_containerPtr);
+        if(m_rawContainerPtr)
+            this->moveToBegin();
     }
 
     // Construct from container
@@ -101,9 +213,10 @@ public: // Constructors and destructors
     blIterator(const blContainerPtr& containerPtr)
     {
         m_containerPtr = containerPtr;
+        m_rawContainerPtr = m_containerPtr.get();
 
-        if(m_containerPtr)
-            m_ptr = blBeginEndFunctorType::begin(*m_containerPtr);
+        if(m_rawContainerPtr)
+            this->moveToBegin();
     }
 
     // Construct from iterator
@@ -114,15 +227,38 @@ public: // Constructors and destructors
     {
         m_ptr = ptr;
         m_containerPtr = containerPtr;
+        m_rawContainerPtr = m_containerPtr.get();
+
+        this->resyncPosition();
+    }
+
+    // Construct a borrowed
+    // iterator from container
+    //
+    // NOTE:    A borrowed iterator does
+    //          not share ownership of the
+    //          container, so creating and
+    //          copying it never touches a
+    //          shared reference count.
+    //          The container has to outlive
+    //          it, usually by holding a
+    //          blBorrowGuard while using it.
+
+    blIterator(blContainerType& container,
+               const blBorrowTag&)
+    {
+        m_rawContainerPtr = &container;
+
+        this->moveToBegin();
     }
 
     // Copy constructor
 
-    blIterator(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>&) = default;
+    blIterator(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>&) = default;
 
     // Move constructor
 
-    blIterator(blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>&&) = default;
+    blIterator(blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>&&) = default;
 
     // Destructor
 
@@ -134,7 +270,8 @@ public: // Assignment operator
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>&                              operator=(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>& iterator) = default;
+               blBeginEndFunctorType,
+               blInstrumentationType>&                              operator=(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& iterator) = default;
 
 public: // Dereferencing operators
 
@@ -148,16 +285,16 @@ public: // Overloaded operators
     // inequality
     // operators
 
-    bool                                                            operator==(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>& iterator)const
+    bool                                                            operator==(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& iterator)const
     {
         return ( (m_ptr == iterator.getPtr()) &&
-                 (m_containerPtr == iterator.getContainerPtr()) );
+                 (m_rawContainerPtr == iterator.getRawContainerPtr()) );
     }
 
-    bool                                                            operator!=(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>& iterator)const
+    bool                                                            operator!=(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& iterator)const
     {
         return ( (m_ptr != iterator.getPtr()) ||
-                 (m_containerPtr != iterator.getContainerPtr()) );
+                 (m_rawContainerPtr != iterator.getRawContainerPtr()) );
     }
 
     // Bool operator
@@ -167,7 +304,7 @@ public: // Overloaded operators
 
     explicit operator                                               bool()const
     {
-        if(this->m_containerPtr)
+        if(this->m_rawContainerPtr)
             return true;
         else
             return false;
@@ -178,7 +315,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>&                              operator++()
+               blBeginEndFunctorType,
+               blInstrumentationType>&                              operator++()
     {
         this->advance(1);
         return (*this);
@@ -186,7 +324,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               operator++(int)
+               blBeginEndFunctorType,
+               blInstrumentationType>                               operator++(int)
     {
         auto TempIter(*this);
 
@@ -197,7 +336,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>&                              operator--()
+               blBeginEndFunctorType,
+               blInstrumentationType>&                              operator--()
     {
         this->advance(-1);
         return (*this);
@@ -205,7 +345,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               operator--(int)
+               blBeginEndFunctorType,
+               blInstrumentationType>                               operator--(int)
     {
         auto TempIter(*this);
 
@@ -220,7 +361,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>&                              operator+=(const ptrdiff_t& Offset)
+               blBeginEndFunctorType,
+               blInstrumentationType>&                              operator+=(const ptrdiff_t& Offset)
     {
         this->advance(Offset);
         return (*this);
@@ -228,7 +370,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>&                              operator-=(const ptrdiff_t& Offset)
+               blBeginEndFunctorType,
+               blInstrumentationType>&                              operator-=(const ptrdiff_t& Offset)
     {
         this->advance(-Offset);
         return (*this);
@@ -236,7 +379,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               operator+(const ptrdiff_t& Offset)const
+               blBeginEndFunctorType,
+               blInstrumentationType>                               operator+(const ptrdiff_t& Offset)const
     {
         auto NewIter = (*this);
         NewIter.advance(Offset);
@@ -245,7 +389,8 @@ public: // Overloaded operators
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               operator-(const ptrdiff_t& Offset)const
+               blBeginEndFunctorType,
+               blInstrumentationType>                               operator-(const ptrdiff_t& Offset)const
     {
         auto NewIter = (*this);
         NewIter.advance(-Offset);
@@ -257,13 +402,21 @@ public: // Overloaded operators
     // the distance
     // between two
     // iterators
+    //
+    // NOTE:    Like for pointers,
+    //          (iter2 - iter1) is
+    //          how far iter1 has
+    //          to advance to get
+    //          to iter2
 
-    ptrdiff_t                                                       operator-(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType>& iterator)const
+    ptrdiff_t                                                       operator-(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& iterator)const
     {
-        return blAdvanceDistanceFunctorType::distance(this->getDistanceFromBeginToIter(),
-                                                      iterator.getDistanceFromBeginToIter(),
-                                                      this->getDistanceFromIterToEnd(),
-                                                      iterator.getDistanceFromIterToEnd());
+        return blInvokeDistance<blAdvanceDistanceFunctorType>(iterator.getDistanceFromBeginToIter(),
+                                                              this->getDistanceFromBeginToIter(),
+                                                              iterator.getDistanceFromIterToEnd(),
+                                                              this->getDistanceFromIterToEnd(),
+                                                              iterator.getAdvanceState(),
+                                                              this->getAdvanceState());
     }
 
 public: // Public functions
@@ -275,13 +428,14 @@ public: // Public functions
     {
         auto containerPtr = get_shared_ptr(container);
 
-        if(containerPtr != m_containerPtr)
+        if(containerPtr.get() != m_rawContainerPtr)
         {
             m_containerPtr = containerPtr;
+            m_rawContainerPtr = m_containerPtr.get();
 
-            if(m_containerPtr)
+            if(m_rawContainerPtr)
             {
-                (*this) = this->begin();
+                this->moveToBegin();
             }
         }
     }
@@ -290,13 +444,14 @@ public: // Public functions
     {
         auto containerPtr = get_shared_ptr(container);
 
-        if(containerPtr != m_containerPtr)
+        if(containerPtr.get() != m_rawContainerPtr)
         {
             m_containerPtr = containerPtr;
+            m_rawContainerPtr = m_containerPtr.get();
 
-            if(m_containerPtr)
+            if(m_rawContainerPtr)
             {
-                (*this) = this->begin();
+                this->moveToBegin();
             }
         }
     }
@@ -305,13 +460,14 @@ public: // Public functions
     {
         auto containerPtr = get_shared_ptr(rawContainerPtr);
 
-        if(containerPtr != m_containerPtr)
+        if(containerPtr.get() != m_rawContainerPtr)
         {
             m_containerPtr = containerPtr;
+            m_rawContainerPtr = m_containerPtr.get();
 
-            if(m_containerPtr)
+            if(m_rawContainerPtr)
             {
-                (*this) = this->begin();
+                this->moveToBegin();
             }
         }
     }
@@ -322,6 +478,22 @@ public: // Public functions
 
     const iterator&                                                 getPtr()const{return m_ptr;}
     const blContainerPtr&                                           getContainerPtr()const{return m_containerPtr;}
+    blContainerType*                                                getRawContainerPtr()const{return m_rawContainerPtr;}
+
+    // Function used to know
+    // whether this iterator
+    // borrows its container
+    // instead of sharing its
+    // ownership
+
+    bool                                                            isBorrowed()const{return (m_rawContainerPtr != nullptr && !m_containerPtr);}
+
+    // Function used to get
+    // the state of the advance
+    // functor (for example the
+    // direction of blAdvanceReflect)
+
+    using blIteratorAdvanceState<blAdvanceStateType>::getAdvanceState;
 
     // Functions used to
     // get the distance
@@ -332,18 +504,29 @@ public: // Public functions
 
     ptrdiff_t                                                       getDistanceFromBeginToIter()const
     {
-        if(m_containerPtr)
-            return std::distance(blBeginEndFunctorType::begin(*m_containerPtr),this->m_ptr);
-        else
-            return 0;
+        return this->getDistanceFromBeginToIter(blIsPositionTracked());
     }
 
     ptrdiff_t                                                       getDistanceFromIterToEnd()const
     {
-        if(m_containerPtr)
-            return std::distance(this->m_ptr,blBeginEndFunctorType::end(*m_containerPtr));
-        else
-            return 0;
+        return this->getDistanceFromIterToEnd(blIsPositionTracked());
+    }
+
+    // Function used to
+    // recalculate the
+    // stored position
+    //
+    // NOTE:    Only needed by iterators
+    //          over containers without
+    //          random access, after the
+    //          container's size changed
+    //          without invalidating the
+    //          iterator (for example after
+    //          a std::list::push_back)
+
+    void                                                            resyncPosition()
+    {
+        this->resyncPosition(blIsPositionTracked());
     }
 
     // Functions used to
@@ -354,36 +537,50 @@ public: // Public functions
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               begin()const
+               blBeginEndFunctorType,
+               blInstrumentationType>                               begin()const
     {
-        if(m_containerPtr)
+        if(m_rawContainerPtr)
         {
-            return blIterator<blContainerType,
-                              blAdvanceDistanceFunctorType,
-                              blBeginEndFunctorType>(blBeginEndFunctorType::begin(*m_containerPtr),
-                                                     m_containerPtr);
+            auto beginIter = (*this);
+
+            beginIter.m_ptr = blBeginEndFunctorType::begin(*m_rawContainerPtr);
+            beginIter.resetAdvanceState();
+            beginIter.setPosition(0,
+                                  this->getDistanceFromBeginToIter() + this->getDistanceFromIterToEnd(),
+                                  blIsPositionTracked());
+
+            return beginIter;
         }
         else
             return blIterator<blContainerType,
                               blAdvanceDistanceFunctorType,
-                              blBeginEndFunctorType>(m_containerPtr);
+                              blBeginEndFunctorType,
+                              blInstrumentationType>(m_containerPtr);
     }
 
     blIterator<blContainerType,
                blAdvanceDistanceFunctorType,
-               blBeginEndFunctorType>                               end()const
+               blBeginEndFunctorType,
+               blInstrumentationType>                               end()const
     {
-        if(m_containerPtr)
+        if(m_rawContainerPtr)
         {
-            return blIterator<blContainerType,
-                              blAdvanceDistanceFunctorType,
-                              blBeginEndFunctorType>(blBeginEndFunctorType::end(*m_containerPtr),
-                                                     m_containerPtr);
+            auto endIter = (*this);
+
+            endIter.m_ptr = blBeginEndFunctorType::end(*m_rawContainerPtr);
+            endIter.resetAdvanceState();
+            endIter.setPosition(this->getDistanceFromBeginToIter() + this->getDistanceFromIterToEnd(),
+                                0,
+                                blIsPositionTracked());
+
+            return endIter;
         }
         else
             return blIterator<blContainerType,
                               blAdvanceDistanceFunctorType,
-                              blBeginEndFunctorType>(m_containerPtr);
+                              blBeginEndFunctorType,
+                              blInstrumentationType>(m_containerPtr);
     }
 
     // Operators used to
@@ -406,8 +603,8 @@ public: // Public functions
 
     size_t                                                          size()const
     {
-        if(m_containerPtr)
-            return m_containerPtr->size();
+        if(m_rawContainerPtr)
+            return m_rawContainerPtr->size();
         else
             return 0;
     }
@@ -416,6 +613,54 @@ public: // Public functions
     size_t                                                          max_size()const{return this->size();}
     bool                                                            empty()const{return (this->size() == 0);}
 
+    // Functions used to take
+    // a batch of up to "n"
+    // contiguous elements
+    // starting at the iterator,
+    // and then move the iterator
+    // past the batch with a single
+    // advance
+    //
+    // NOTE:    - The batch stops at the
+    //            container's end, so a
+    //            circular iterator's batch
+    //            stops at the wrap and the
+    //            iterator then wraps around
+    //            to the begin
+    //
+    //          - Only available when the
+    //            underlying iterator walks
+    //            forward through contiguous
+    //            memory, or through blocks of
+    //            it, in which case the batch
+    //            also stops at the block's end
+
+    blBatchType                                                     next_n(const size_t& n)
+    {
+        static_assert(blIsContiguousRange<blContainerType,iterator>::value ||
+                      blIsSegmentedIterator<iterator>::value,
+                      "blIterator::next_n is only available for contiguous or segmented containers");
+
+        ptrdiff_t batchSize = this->getDistanceFromIterToEnd();
+
+        if(static_cast<ptrdiff_t>(n) < batchSize)
+            batchSize = static_cast<ptrdiff_t>(n);
+
+        if(batchSize > 0)
+            batchSize = getContiguousLength(m_ptr,batchSize);
+
+        if(!m_rawContainerPtr || batchSize <= 0)
+            return blBatchType();
+
+        blBatchType batch(getDataPointer(m_ptr),static_cast<size_t>(batchSize));
+
+        this->advance(batchSize);
+
+        return batch;
+    }
+
+    blBatchType                                                     take_batch(const size_t& n){return this->next_n(n);}
+
 private: // Special functions
     
     // Function used
@@ -424,14 +669,209 @@ private: // Special functions
     
     void                                                            advance(const ptrdiff_t& HowManyStepsToAdvanceIter)
     {
-        if(m_containerPtr)
+        if(m_rawContainerPtr)
+        {
+            this->advance(HowManyStepsToAdvanceIter,
+                          blIsPositionTracked(),
+                          typename blHasAdvanceDistances<blAdvanceDistanceFunctorType>::type());
+        }
+    }
+
+    // Random access iterators
+    // are moved by the advance
+    // functor
+    //
+    // NOTE:    The instrumentation
+    //          gets told how far the
+    //          iterator was asked to
+    //          move and whether it got
+    //          clamped or wrapped around,
+    //          with the default
+    //          blNoInstrumentation all
+    //          of this compiles away
+
+    template<typename blHasAdvanceDistancesType>
+    void                                                            advance(const ptrdiff_t& HowManyStepsToAdvanceIter,
+                                                                            std::false_type,
+                                                                            blHasAdvanceDistancesType)
+    {
+        blInstrumentationType::onAdvance(HowManyStepsToAdvanceIter,
+                                         blInvokeAdvance<blAdvanceDistanceFunctorType>(m_ptr,
+                                                                                       HowManyStepsToAdvanceIter,
+                                                                                       blBeginEndFunctorType::begin(*m_rawContainerPtr),
+                                                                                       blBeginEndFunctorType::end(*m_rawContainerPtr),
+                                                                                       this->getDistanceFromBeginToIter(),
+                                                                                       this->getDistanceFromIterToEnd(),
+                                                                                       this->advanceState()));
+    }
+
+    // Other iterators, when the
+    // advance functor can tell
+    // where the iterator will end
+    // up, are walked there from the
+    // closest of their current
+    // position, the begin or the end
+
+    void                                                            advance(const ptrdiff_t& HowManyStepsToAdvanceIter,
+                                                                            std::true_type,
+                                                                            std::true_type)
+    {
+        ptrdiff_t distanceFromBeginToIter = this->m_distanceFromBeginToIter;
+        ptrdiff_t distanceFromIterToEnd = this->m_distanceFromIterToEnd;
+
+        blAdvanceEvent advanceEvent = blInvokeAdvanceDistances<blAdvanceDistanceFunctorType>(HowManyStepsToAdvanceIter,
+                                                                                             distanceFromBeginToIter,
+                                                                                             distanceFromIterToEnd,
+                                                                                             this->advanceState());
+
+        this->walkTo(distanceFromBeginToIter,blIteratorCategory());
+
+        blInstrumentationType::onAdvance(HowManyStepsToAdvanceIter,advanceEvent);
+    }
+
+    // Otherwise the advance functor
+    // moves the iterator and the
+    // position has to be found again
+
+    void                                                            advance(const ptrdiff_t& HowManyStepsToAdvanceIter,
+                                                                            std::true_type,
+                                                                            std::false_type)
+    {
+        blAdvanceEvent advanceEvent = blInvokeAdvance<blAdvanceDistanceFunctorType>(m_ptr,
+                                                                                    HowManyStepsToAdvanceIter,
+                                                                                    blBeginEndFunctorType::begin(*m_rawContainerPtr),
+                                                                                    blBeginEndFunctorType::end(*m_rawContainerPtr),
+                                                                                    this->m_distanceFromBeginToIter,
+                                                                                    this->m_distanceFromIterToEnd,
+                                                                                    this->advanceState());
+
+        ptrdiff_t size = this->m_distanceFromBeginToIter + this->m_distanceFromIterToEnd;
+
+        this->m_distanceFromBeginToIter = std::distance(blBeginEndFunctorType::begin(*m_rawContainerPtr),m_ptr);
+        this->m_distanceFromIterToEnd = size - this->m_distanceFromBeginToIter;
+
+        blInstrumentationType::onAdvance(HowManyStepsToAdvanceIter,advanceEvent);
+    }
+
+    // Functions used to walk
+    // a non random access
+    // iterator to a position
+
+    void                                                            walkTo(const ptrdiff_t& distanceFromBeginToIter,
+                                                                           std::bidirectional_iterator_tag)
+    {
+        ptrdiff_t size = this->m_distanceFromBeginToIter + this->m_distanceFromIterToEnd;
+        ptrdiff_t stepsFromIter = distanceFromBeginToIter - this->m_distanceFromBeginToIter;
+        ptrdiff_t stepsFromEnd = size - distanceFromBeginToIter;
+
+        ptrdiff_t absoluteStepsFromIter = (stepsFromIter < 0 ? -stepsFromIter : stepsFromIter);
+
+        if(absoluteStepsFromIter <= distanceFromBeginToIter && absoluteStepsFromIter <= stepsFromEnd)
+        {
+            std::advance(m_ptr,stepsFromIter);
+        }
+        else if(distanceFromBeginToIter <= stepsFromEnd)
+        {
+            m_ptr = blBeginEndFunctorType::begin(*m_rawContainerPtr);
+            std::advance(m_ptr,distanceFromBeginToIter);
+        }
+        else
+        {
+            m_ptr = blBeginEndFunctorType::end(*m_rawContainerPtr);
+            std::advance(m_ptr,-stepsFromEnd);
+        }
+
+        this->setPosition(distanceFromBeginToIter,stepsFromEnd,blIsPositionTracked());
+    }
+
+    void                                                            walkTo(const ptrdiff_t& distanceFromBeginToIter,
+                                                                           std::forward_iterator_tag)
+    {
+        ptrdiff_t size = this->m_distanceFromBeginToIter + this->m_distanceFromIterToEnd;
+
+        if(distanceFromBeginToIter >= this->m_distanceFromBeginToIter)
+        {
+            std::advance(m_ptr,distanceFromBeginToIter - this->m_distanceFromBeginToIter);
+        }
+        else
+        {
+            m_ptr = blBeginEndFunctorType::begin(*m_rawContainerPtr);
+            std::advance(m_ptr,distanceFromBeginToIter);
+        }
+
+        this->setPosition(distanceFromBeginToIter,size - distanceFromBeginToIter,blIsPositionTracked());
+    }
+
+    // Function used to move
+    // the iterator to the
+    // begin of the container
+
+    void                                                            moveToBegin()
+    {
+        m_ptr = blBeginEndFunctorType::begin(*m_rawContainerPtr);
+
+        this->resetAdvanceState();
+        this->resyncPosition();
+    }
+
+    // Functions used to get and
+    // set the stored position
+
+    ptrdiff_t                                                       getDistanceFromBeginToIter(std::false_type)const
+    {
+        if(m_rawContainerPtr)
+            return std::distance(blBeginEndFunctorType::begin(*m_rawContainerPtr),this->m_ptr);
+        else
+            return 0;
+    }
+
+    ptrdiff_t                                                       getDistanceFromBeginToIter(std::true_type)const
+    {
+        return this->m_distanceFromBeginToIter;
+    }
+
+    ptrdiff_t                                                       getDistanceFromIterToEnd(std::false_type)const
+    {
+        if(m_rawContainerPtr)
+            return std::distance(this->m_ptr,blBeginEndFunctorType::end(*m_rawContainerPtr));
+        else
+            return 0;
+    }
+
+    ptrdiff_t                                                       getDistanceFromIterToEnd(std::true_type)const
+    {
+        return this->m_distanceFromIterToEnd;
+    }
+
+    void                                                            setPosition(const ptrdiff_t&,
+                                                                                const ptrdiff_t&,
+                                                                                std::false_type)
+    {
+    }
+
+    void                                                            setPosition(const ptrdiff_t& distanceFromBeginToIter,
+                                                                                const ptrdiff_t& distanceFromIterToEnd,
+                                                                                std::true_type)
+    {
+        this->m_distanceFromBeginToIter = distanceFromBeginToIter;
+        this->m_distanceFromIterToEnd = distanceFromIterToEnd;
+    }
+
+    void                                                            resyncPosition(std::false_type)
+    {
+    }
+
+    void                                                            resyncPosition(std::true_type)
+    {
+        if(m_rawContainerPtr)
+        {
+            this->m_distanceFromBeginToIter = std::distance(blBeginEndFunctorType::begin(*m_rawContainerPtr),m_ptr);
+            this->m_distanceFromIterToEnd = std::distance(m_ptr,blBeginEndFunctorType::end(*m_rawContainerPtr));
+        }
+        else
         {
-            blAdvanceDistanceFunctorType::advance(m_ptr,
-                                                  HowManyStepsToAdvanceIter,
-                                                  this->begin().m_ptr,
-                                                  this->end().m_ptr,
-                                                  this->getDistanceFromBeginToIter(),
-                                                  this->getDistanceFromIterToEnd());
+            this->m_distanceFromBeginToIter = 0;
+            this->m_distanceFromIterToEnd = 0;
         }
     }
 };
@@ -104,6 +104,58 @@
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// Includes and libs needed for this library
+//
+// NOTE:    The library's files are included
+//          inside the blIteratorAPI namespace,
+//          so the standard headers they need
+//          are all included here first
+//-------------------------------------------------------------------
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <cmath>
+#include <cstdlib>
+#include <cassert>
+#include <memory>
+#include <type_traits>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <limits>
+#include <functional>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #include <immintrin.h>
+#endif
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+    #if __has_include(<coroutine>)
+        #include <coroutine>
+        #include <exception>
+        #include <utility>
+        #define BL_COROUTINES_ENABLED
+    #endif
+#endif
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 namespace blIteratorAPI
 {
@@ -115,6 +167,27 @@ namespace blIteratorAPI
 
 
 
+    // Memory resources (a monotonic arena
+    // and a fixed-size pool) and the c++
+    // allocators built on top of them, used
+    // to cheaply create and destroy short
+    // lived containers
+
+    #include "blAllocators.hpp"
+
+
+
+
+    // A guard keeping a shared container
+    // alive while "borrowed" iterators,
+    // which never touch the container's
+    // shared reference count, are used
+
+    #include "blBorrowGuard.hpp"
+
+
+
+
     // These classes define a raw pointer
     // iterator and reverse iterator for
     // iterating through raw arrays of data
@@ -124,6 +197,27 @@ namespace blIteratorAPI
 
 
 
+    // Traits used to know whether an
+    // iterator walks through contiguous
+    // memory, and functions used to get
+    // the raw pointer it points to
+
+    #include "blIteratorTraits.hpp"
+
+
+
+
+    // Expression templates used to evaluate
+    // element-wise arithmetic, comparisons
+    // and math functions on blArrays and
+    // blRawArrayWrappers in a single pass,
+    // without temporary arrays
+
+    #include "blExpression.hpp"
+
+
+
+
     // A simple static templated array
     // with some helper functions such
     // as begin, end, size that makes
@@ -135,6 +229,26 @@ namespace blIteratorAPI
 
 
 
+    // Algorithms (for each, transform, reduce,
+    // dot and equal) over blArrays, fully
+    // unrolled at compile time for small
+    // arrays
+
+    #include "blArrayAlgorithms.hpp"
+
+
+
+
+    // A static array whose elements each
+    // sit on their own cache line, used
+    // for per-thread data without false
+    // sharing
+
+    #include "blPaddedArray.hpp"
+
+
+
+
     // This class is used to wrap a raw
     // static or dynamic array with the
     // basic functionality needed to use
@@ -146,6 +260,63 @@ namespace blIteratorAPI
 
 
 
+    // Arrays of bits packed into 64-bit
+    // words (static and wrapped), with
+    // proxy references and word-at-a-time
+    // count, find and bitwise operations
+
+    #include "blBitArray.hpp"
+
+
+
+
+    // Least significant digit radix sort of
+    // arrays of integers, floats or elements
+    // with such keys
+
+    #include "blRadixSort.hpp"
+
+
+
+
+    // Views of single channels of interleaved
+    // buffers and (de)interleaving of whole
+    // buffers into one array per channel
+
+    #include "blChannelView.hpp"
+
+
+
+
+    // A container made of fixed size blocks
+    // with stable addresses and O(1) random
+    // access, whose segmented iterators let
+    // algorithms loop over whole blocks
+
+    #include "blSegmentedArray.hpp"
+
+
+
+
+    // Owning circular buffers (static and
+    // run time capacity) with push, pop,
+    // bulk push and linearize, whose
+    // iterators start at the oldest element
+
+    #include "blCircularBuffer.hpp"
+
+
+
+
+    // A ring buffer whose pages are mapped
+    // twice back to back, so any window of
+    // it is one contiguous span
+
+    #include "blMirroredRingBuffer.hpp"
+
+
+
+
     // Functors defined in this file are used
     // by iterators in the blIteratorAPI library
     // to "advance" and to get "begin" and "end"
@@ -156,6 +327,16 @@ namespace blIteratorAPI
 
 
 
+    // Instrumentation policies used by the
+    // iterators in the blIteratorAPI library
+    // to count how they advance (by default
+    // nothing is counted)
+
+    #include "blIteratorInstrumentation.hpp"
+
+
+
+
     // This class provides a generic iterator which
     // wraps a user specified container.
     // The iterator is customizable through user-provided
@@ -198,6 +379,123 @@ namespace blIteratorAPI
 
         template<typename blContainerType>
         class blCircularConstReverseIterator : public blIterator<blContainerType,blAdvanceCircularly,blcrBeginEnd>{using blIterator<blContainerType,blAdvanceCircularly,blcrBeginEnd>::blIterator;};
+
+    // Define some useful reflecting
+    // (ping-pong) iterators
+
+        template<typename blContainerType>
+        class blReflectIterator : public blIterator<blContainerType,blAdvanceReflect,blBeginEnd>{using blIterator<blContainerType,blAdvanceReflect,blBeginEnd>::blIterator;};
+
+        template<typename blContainerType>
+        class blReflectConstIterator : public blIterator<blContainerType,blAdvanceReflect,blcBeginEnd>{using blIterator<blContainerType,blAdvanceReflect,blcBeginEnd>::blIterator;};
+
+        template<typename blContainerType>
+        class blReflectReverseIterator : public blIterator<blContainerType,blAdvanceReflect,blrBeginEnd>{using blIterator<blContainerType,blAdvanceReflect,blrBeginEnd>::blIterator;};
+
+        template<typename blContainerType>
+        class blReflectConstReverseIterator : public blIterator<blContainerType,blAdvanceReflect,blcrBeginEnd>{using blIterator<blContainerType,blAdvanceReflect,blcrBeginEnd>::blIterator;};
+
+
+
+
+    // A window sliding circularly over a
+    // container, which keeps its sum, mean,
+    // variance, min and max up to date as
+    // it slides
+
+    #include "blSlidingWindow.hpp"
+
+
+
+
+    // Vectorized find, count and min/max over
+    // raw arrays and over smart iterator ranges
+    // of contiguous containers, choosing the
+    // instruction set at run time
+
+    #include "blSimdAlgorithms.hpp"
+
+
+
+
+    // A read only container of integers
+    // stored delta encoded and bit packed
+    // in blocks, decoded on the fly by its
+    // iterators (with AVX2 block unpacking)
+
+    #include "blCompressedArray.hpp"
+
+
+
+
+    // A type erased iterator holding any
+    // blIterator inline (no allocations),
+    // used to pass iterators through plugin
+    // boundaries, with batched segment fetch
+
+    #include "blAnyIterator.hpp"
+
+
+
+
+    // A c++20 coroutine generator yielding
+    // its values in blocks, so they can be
+    // consumed lazily by the library's
+    // algorithms (only compiled when the
+    // compiler supports coroutines)
+
+    #include "blGenerator.hpp"
+
+
+
+
+    // Views of arrays through arrays of
+    // indices, with prefetching iterators,
+    // and (AVX2) gather and scatter of the
+    // indexed elements
+
+    #include "blIndirectView.hpp"
+
+
+
+
+    // A circular iterator stepping through
+    // samples at a fractional rate with a
+    // 32.32 fixed point phase, dereferencing
+    // to linear, cubic or windowed sinc
+    // interpolated values, with block render
+
+    #include "blFractionalIterator.hpp"
+
+
+
+
+    // An iterator merging K sorted ranges
+    // into one ordered stream through a
+    // tournament (loser) tree, with batched
+    // output into buffers
+
+    #include "blMergeIterator.hpp"
+
+
+
+
+    // Multithreaded inclusive and exclusive
+    // prefix sums (scans) over raw arrays
+    // and blIterator ranges, with SSE2
+    // in-chunk sums
+
+    #include "blParallelScan.hpp"
+
+
+
+
+    // An iterator downsampling blIterator
+    // ranges, yielding one aggregate (mean,
+    // min, max, first or LTTB) per bucket
+    // of elements
+
+    #include "blDecimatingIterator.hpp"
 }
 //-------------------------------------------------------------------
 
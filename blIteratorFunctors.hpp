@@ -41,6 +41,259 @@
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// What happened to an iterator when
+// it was advanced
+//
+// NOTE:    The advance functors of this
+//          library return one of these
+//          values so that instrumentation
+//          (see blIteratorInstrumentation.hpp)
+//          can tell plain steps from steps
+//          that were clamped at the begin/end
+//          or that wrapped around.
+//          User functors can keep returning
+//          void, which counts as a plain step.
+//-------------------------------------------------------------------
+enum blAdvanceEvent
+{
+    blAdvanceStepped,
+    blAdvanceClamped,
+    blAdvanceWrapped
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to call an advance functor
+// whether it returns a blAdvanceEvent or not
+//-------------------------------------------------------------------
+template<typename blAdvanceDistanceFunctorType,
+         typename blIteratorType>
+
+inline auto blInvokeAdvance(blIteratorType& iter,
+                            const ptrdiff_t& howManyStepsToAdvanceIter,
+                            const blIteratorType& beginIter,
+                            const blIteratorType& endIter,
+                            const ptrdiff_t& distanceFromBeginToIter,
+                            const ptrdiff_t& distanceFromIterToEnd)
+->typename std::enable_if<std::is_void<decltype(blAdvanceDistanceFunctorType::advance(iter,howManyStepsToAdvanceIter,beginIter,endIter,distanceFromBeginToIter,distanceFromIterToEnd))>::value,blAdvanceEvent>::type
+{
+    blAdvanceDistanceFunctorType::advance(iter,
+                                          howManyStepsToAdvanceIter,
+                                          beginIter,
+                                          endIter,
+                                          distanceFromBeginToIter,
+                                          distanceFromIterToEnd);
+
+    return blAdvanceStepped;
+}
+
+template<typename blAdvanceDistanceFunctorType,
+         typename blIteratorType>
+
+inline auto blInvokeAdvance(blIteratorType& iter,
+                            const ptrdiff_t& howManyStepsToAdvanceIter,
+                            const blIteratorType& beginIter,
+                            const blIteratorType& endIter,
+                            const ptrdiff_t& distanceFromBeginToIter,
+                            const ptrdiff_t& distanceFromIterToEnd)
+->typename std::enable_if<!std::is_void<decltype(blAdvanceDistanceFunctorType::advance(iter,howManyStepsToAdvanceIter,beginIter,endIter,distanceFromBeginToIter,distanceFromIterToEnd))>::value,blAdvanceEvent>::type
+{
+    return blAdvanceDistanceFunctorType::advance(iter,
+                                                 howManyStepsToAdvanceIter,
+                                                 beginIter,
+                                                 endIter,
+                                                 distanceFromBeginToIter,
+                                                 distanceFromIterToEnd);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The state of an advance functor
+//
+// NOTE:    Advance functors that need to
+//          remember something between two
+//          advances (like the direction of
+//          blAdvanceReflect) define:
+//
+//          typedef ... blAdvanceStateType;
+//
+//          and take a reference to it as the
+//          last argument of their "advance",
+//          "advanceDistances" and (two const
+//          references for) "distance".
+//          blIterator stores the state, while
+//          functors without one get the empty
+//          blNoAdvanceState, which costs nothing
+//-------------------------------------------------------------------
+struct blNoAdvanceState
+{
+};
+
+template<typename blAdvanceDistanceFunctorType>
+
+struct blAdvanceStateOf
+{
+    template<typename blFunctorType>
+    static typename blFunctorType::blAdvanceStateType   test(int);
+
+    template<typename blFunctorType>
+    static blNoAdvanceState                             test(...);
+
+    typedef decltype(test<blAdvanceDistanceFunctorType>(0)) type;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to call an advance
+// functor with or without its state
+//-------------------------------------------------------------------
+template<typename blAdvanceDistanceFunctorType,
+         typename blIteratorType>
+
+inline blAdvanceEvent blInvokeAdvance(blIteratorType& iter,
+                                      const ptrdiff_t& howManyStepsToAdvanceIter,
+                                      const blIteratorType& beginIter,
+                                      const blIteratorType& endIter,
+                                      const ptrdiff_t& distanceFromBeginToIter,
+                                      const ptrdiff_t& distanceFromIterToEnd,
+                                      blNoAdvanceState)
+{
+    return blInvokeAdvance<blAdvanceDistanceFunctorType>(iter,
+                                                         howManyStepsToAdvanceIter,
+                                                         beginIter,
+                                                         endIter,
+                                                         distanceFromBeginToIter,
+                                                         distanceFromIterToEnd);
+}
+
+template<typename blAdvanceDistanceFunctorType,
+         typename blIteratorType,
+         typename blAdvanceStateType>
+
+inline blAdvanceEvent blInvokeAdvance(blIteratorType& iter,
+                                      const ptrdiff_t& howManyStepsToAdvanceIter,
+                                      const blIteratorType& beginIter,
+                                      const blIteratorType& endIter,
+                                      const ptrdiff_t& distanceFromBeginToIter,
+                                      const ptrdiff_t& distanceFromIterToEnd,
+                                      blAdvanceStateType& advanceState)
+{
+    return blAdvanceDistanceFunctorType::advance(iter,
+                                                 howManyStepsToAdvanceIter,
+                                                 beginIter,
+                                                 endIter,
+                                                 distanceFromBeginToIter,
+                                                 distanceFromIterToEnd,
+                                                 advanceState);
+}
+
+template<typename blAdvanceDistanceFunctorType>
+
+inline auto blInvokeAdvanceDistances(const ptrdiff_t& howManyStepsToAdvanceIter,
+                                     ptrdiff_t& distanceFromBeginToIter,
+                                     ptrdiff_t& distanceFromIterToEnd,
+                                     blNoAdvanceState)
+->decltype(blAdvanceDistanceFunctorType::advanceDistances(howManyStepsToAdvanceIter,distanceFromBeginToIter,distanceFromIterToEnd))
+{
+    return blAdvanceDistanceFunctorType::advanceDistances(howManyStepsToAdvanceIter,
+                                                          distanceFromBeginToIter,
+                                                          distanceFromIterToEnd);
+}
+
+template<typename blAdvanceDistanceFunctorType,
+         typename blAdvanceStateType>
+
+inline auto blInvokeAdvanceDistances(const ptrdiff_t& howManyStepsToAdvanceIter,
+                                     ptrdiff_t& distanceFromBeginToIter,
+                                     ptrdiff_t& distanceFromIterToEnd,
+                                     blAdvanceStateType& advanceState)
+->decltype(blAdvanceDistanceFunctorType::advanceDistances(howManyStepsToAdvanceIter,distanceFromBeginToIter,distanceFromIterToEnd,advanceState))
+{
+    return blAdvanceDistanceFunctorType::advanceDistances(howManyStepsToAdvanceIter,
+                                                          distanceFromBeginToIter,
+                                                          distanceFromIterToEnd,
+                                                          advanceState);
+}
+
+template<typename blAdvanceDistanceFunctorType>
+
+inline ptrdiff_t blInvokeDistance(const ptrdiff_t& distanceFromBeginToIter1,
+                                  const ptrdiff_t& distanceFromBeginToIter2,
+                                  const ptrdiff_t& distanceFromIterToEnd1,
+                                  const ptrdiff_t& distanceFromIterToEnd2,
+                                  blNoAdvanceState,
+                                  blNoAdvanceState)
+{
+    return blAdvanceDistanceFunctorType::distance(distanceFromBeginToIter1,
+                                                  distanceFromBeginToIter2,
+                                                  distanceFromIterToEnd1,
+                                                  distanceFromIterToEnd2);
+}
+
+template<typename blAdvanceDistanceFunctorType,
+         typename blAdvanceStateType>
+
+inline ptrdiff_t blInvokeDistance(const ptrdiff_t& distanceFromBeginToIter1,
+                                  const ptrdiff_t& distanceFromBeginToIter2,
+                                  const ptrdiff_t& distanceFromIterToEnd1,
+                                  const ptrdiff_t& distanceFromIterToEnd2,
+                                  const blAdvanceStateType& advanceState1,
+                                  const blAdvanceStateType& advanceState2)
+{
+    return blAdvanceDistanceFunctorType::distance(distanceFromBeginToIter1,
+                                                  distanceFromBeginToIter2,
+                                                  distanceFromIterToEnd1,
+                                                  distanceFromIterToEnd2,
+                                                  advanceState1,
+                                                  advanceState2);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Trait used to know whether an advance
+// functor defines the static function:
+//
+// - advanceDistances(howManyStepsToAdvanceIter,
+//                    distanceFromBeginToIter,
+//                    distanceFromIterToEnd)
+//
+// which updates the two distances to where
+// "advance" would take the iterator and
+// returns the matching blAdvanceEvent
+// (stateful functors take their state
+// as a fourth argument).
+//
+// NOTE:    blIterator uses it to keep track
+//          of its position without walking
+//          the container when the underlying
+//          iterator is not random access
+//-------------------------------------------------------------------
+template<typename blAdvanceDistanceFunctorType>
+
+struct blHasAdvanceDistances
+{
+    template<typename blFunctorType>
+    static auto                         test(int)->decltype(blInvokeAdvanceDistances<blFunctorType>(std::declval<const ptrdiff_t&>(),
+                                                                                                    std::declval<ptrdiff_t&>(),
+                                                                                                    std::declval<ptrdiff_t&>(),
+                                                                                                    std::declval<typename blAdvanceStateOf<blFunctorType>::type&>()),
+                                                            std::true_type());
+
+    template<typename blFunctorType>
+    static std::false_type              test(...);
+
+    typedef decltype(test<blAdvanceDistanceFunctorType>(0)) type;
+
+    static const bool                   value = type::value;
+};
+//-------------------------------------------------------------------
+
+
 //-------------------------------------------------------------------
 // Define "begin" and "end" functors
 // to use with smart iterators
@@ -99,34 +352,64 @@ struct blcrBeginEnd
 struct blAdvanceLinearly
 {
     template<typename blIteratorType>
-    static void         advance(blIteratorType& iter,
-                                const ptrdiff_t& howManyStepsToAdvanceIter,
-                                const blIteratorType& beginIter,
-                                const blIteratorType& endIter,
-                                const ptrdiff_t& distanceFromBeginToIter,
-                                const ptrdiff_t& distanceFromIterToEnd)
+    static blAdvanceEvent advance(blIteratorType& iter,
+                                  const ptrdiff_t& howManyStepsToAdvanceIter,
+                                  const blIteratorType& beginIter,
+                                  const blIteratorType& endIter,
+                                  const ptrdiff_t& distanceFromBeginToIter,
+                                  const ptrdiff_t& distanceFromIterToEnd)
     {
         if(howManyStepsToAdvanceIter > 0)
         {
             if(howManyStepsToAdvanceIter > distanceFromIterToEnd)
+            {
                 iter = endIter;
+                return blAdvanceClamped;
+            }
             else
                 std::advance(iter,howManyStepsToAdvanceIter);
         }
         else if(howManyStepsToAdvanceIter < 0)
         {
             if((-howManyStepsToAdvanceIter) > distanceFromBeginToIter)
+            {
                 iter = beginIter;
+                return blAdvanceClamped;
+            }
             else
                 std::advance(iter,howManyStepsToAdvanceIter);
         }
+
+        return blAdvanceStepped;
+    }
+
+    static blAdvanceEvent advanceDistances(const ptrdiff_t& howManyStepsToAdvanceIter,
+                                           ptrdiff_t& distanceFromBeginToIter,
+                                           ptrdiff_t& distanceFromIterToEnd)
+    {
+        if(howManyStepsToAdvanceIter > distanceFromIterToEnd)
+        {
+            distanceFromBeginToIter += distanceFromIterToEnd;
+            distanceFromIterToEnd = 0;
+            return blAdvanceClamped;
+        }
+        else if((-howManyStepsToAdvanceIter) > distanceFromBeginToIter)
+        {
+            distanceFromIterToEnd += distanceFromBeginToIter;
+            distanceFromBeginToIter = 0;
+            return blAdvanceClamped;
+        }
+
+        distanceFromBeginToIter += howManyStepsToAdvanceIter;
+        distanceFromIterToEnd -= howManyStepsToAdvanceIter;
+
+        return blAdvanceStepped;
     }
 
-    template<typename blIteratorType>
     static ptrdiff_t    distance(const ptrdiff_t& distanceFromBeginToIter1,
                                  const ptrdiff_t& distanceFromBeginToIter2,
-                                 const ptrdiff_t& distanceFromIterToEnd1,
-                                 const ptrdiff_t& distanceFromIterToEnd2)
+                                 const ptrdiff_t&,
+                                 const ptrdiff_t&)
     {
         return ( distanceFromBeginToIter2 - distanceFromBeginToIter1 );
     }
@@ -148,13 +431,16 @@ struct blAdvanceLinearly
 struct blAdvanceCircularly
 {
     template<typename blIteratorType>
-    static void         advance(blIteratorType& iter,
-                                const ptrdiff_t& howManyStepsToAdvanceIter,
-                                const blIteratorType& beginIter,
-                                const blIteratorType& endIter,
-                                const ptrdiff_t& distanceFromBeginToIter,
-                                const ptrdiff_t& distanceFromIterToEnd)
+    static blAdvanceEvent advance(blIteratorType& iter,
+                                  const ptrdiff_t& howManyStepsToAdvanceIter,
+                                  const blIteratorType& beginIter,
+                                  const blIteratorType&,
+                                  const ptrdiff_t& distanceFromBeginToIter,
+                                  const ptrdiff_t& distanceFromIterToEnd)
     {
+        if(distanceFromBeginToIter + distanceFromIterToEnd == 0)
+            return blAdvanceStepped;
+
         if(howManyStepsToAdvanceIter > 0)
         {
             if(howManyStepsToAdvanceIter < distanceFromIterToEnd)
@@ -168,11 +454,13 @@ struct blAdvanceCircularly
                              (howManyStepsToAdvanceIter - distanceFromIterToEnd) %
                              (distanceFromBeginToIter + distanceFromIterToEnd)
                             );
+
+                return blAdvanceWrapped;
             }
         }
         else if(howManyStepsToAdvanceIter < 0)
         {
-            if((-howManyStepsToAdvanceIter) < distanceFromBeginToIter)
+            if((-howManyStepsToAdvanceIter) <= distanceFromBeginToIter)
                 std::advance(iter,howManyStepsToAdvanceIter);
             else
             {
@@ -180,19 +468,68 @@ struct blAdvanceCircularly
 
                 std::advance(
                              iter,
-                             (distanceFromBeginToIter + distanceFromIterToEnd) +
-                             (howManyStepsToAdvanceIter - distanceFromIterToEnd) %
+                             (
+                              (distanceFromBeginToIter + distanceFromIterToEnd) +
+                              (distanceFromBeginToIter + howManyStepsToAdvanceIter) %
+                              (distanceFromBeginToIter + distanceFromIterToEnd)
+                             ) %
                              (distanceFromBeginToIter + distanceFromIterToEnd)
                             );
+
+                return blAdvanceWrapped;
             }
         }
+
+        return blAdvanceStepped;
+    }
+
+    static blAdvanceEvent advanceDistances(const ptrdiff_t& howManyStepsToAdvanceIter,
+                                           ptrdiff_t& distanceFromBeginToIter,
+                                           ptrdiff_t& distanceFromIterToEnd)
+    {
+        ptrdiff_t size = distanceFromBeginToIter + distanceFromIterToEnd;
+
+        if(size == 0)
+            return blAdvanceStepped;
+
+        if(howManyStepsToAdvanceIter > 0)
+        {
+            if(howManyStepsToAdvanceIter < distanceFromIterToEnd)
+            {
+                distanceFromBeginToIter += howManyStepsToAdvanceIter;
+                distanceFromIterToEnd -= howManyStepsToAdvanceIter;
+            }
+            else
+            {
+                distanceFromBeginToIter = (howManyStepsToAdvanceIter - distanceFromIterToEnd) % size;
+                distanceFromIterToEnd = size - distanceFromBeginToIter;
+
+                return blAdvanceWrapped;
+            }
+        }
+        else if(howManyStepsToAdvanceIter < 0)
+        {
+            if((-howManyStepsToAdvanceIter) <= distanceFromBeginToIter)
+            {
+                distanceFromBeginToIter += howManyStepsToAdvanceIter;
+                distanceFromIterToEnd -= howManyStepsToAdvanceIter;
+            }
+            else
+            {
+                distanceFromBeginToIter = (size + (distanceFromBeginToIter + howManyStepsToAdvanceIter) % size) % size;
+                distanceFromIterToEnd = size - distanceFromBeginToIter;
+
+                return blAdvanceWrapped;
+            }
+        }
+
+        return blAdvanceStepped;
     }
 
-    template<typename blIteratorType>
     static ptrdiff_t    distance(const ptrdiff_t& distanceFromBeginToIter1,
                                  const ptrdiff_t& distanceFromBeginToIter2,
                                  const ptrdiff_t& distanceFromIterToEnd1,
-                                 const ptrdiff_t& distanceFromIterToEnd2)
+                                 const ptrdiff_t&)
     {
         if(distanceFromBeginToIter1 <= distanceFromBeginToIter2)
             return ( distanceFromBeginToIter2 - distanceFromBeginToIter1 );
@@ -205,4 +542,118 @@ struct blAdvanceCircularly
 //-------------------------------------------------------------------
 
 
+//-------------------------------------------------------------------
+// Functor:            - blAdvanceReflect
+//
+// PURPOSE:             - This functor advances an iterator
+//                        back and forth between the first
+//                        and the last element (ping-pong),
+//                        bouncing off both of them, so a
+//                        container of n elements is walked
+//                        0,1,...,n-1,n-2,...,1,0,1,...
+//                      - Its state is the direction, so any
+//                        jump is resolved in O(1) as a "phase"
+//                        over a period of 2*(n-1) steps, where
+//                        phases [0,n-1) move forward and phases
+//                        [n-1,2*(n-1)) move backward
+//                      - Bounces are reported as wraps
+//                      - The "end" iterator is not advanced
+//
+// DEPENDENCIES:        - blAdvance
+//-------------------------------------------------------------------
+struct blAdvanceReflect
+{
+    // The state, true while
+    // moving backward
+
+    typedef bool                        blAdvanceStateType;
+
+    template<typename blIteratorType>
+    static blAdvanceEvent advance(blIteratorType& iter,
+                                  const ptrdiff_t& howManyStepsToAdvanceIter,
+                                  const blIteratorType&,
+                                  const blIteratorType&,
+                                  const ptrdiff_t& distanceFromBeginToIter,
+                                  const ptrdiff_t& distanceFromIterToEnd,
+                                  blAdvanceStateType& isMovingBackward)
+    {
+        ptrdiff_t newDistanceFromBeginToIter = distanceFromBeginToIter;
+        ptrdiff_t newDistanceFromIterToEnd = distanceFromIterToEnd;
+
+        blAdvanceEvent advanceEvent = advanceDistances(howManyStepsToAdvanceIter,
+                                                       newDistanceFromBeginToIter,
+                                                       newDistanceFromIterToEnd,
+                                                       isMovingBackward);
+
+        std::advance(iter,newDistanceFromBeginToIter - distanceFromBeginToIter);
+
+        return advanceEvent;
+    }
+
+    static blAdvanceEvent advanceDistances(const ptrdiff_t& howManyStepsToAdvanceIter,
+                                           ptrdiff_t& distanceFromBeginToIter,
+                                           ptrdiff_t& distanceFromIterToEnd,
+                                           blAdvanceStateType& isMovingBackward)
+    {
+        ptrdiff_t size = distanceFromBeginToIter + distanceFromIterToEnd;
+        ptrdiff_t period = 2 * (size - 1);
+
+        if(period <= 0 || distanceFromIterToEnd == 0)
+            return blAdvanceStepped;
+
+        ptrdiff_t phase = getPhase(distanceFromBeginToIter,isMovingBackward,size);
+        ptrdiff_t newPhase = (phase + howManyStepsToAdvanceIter % period + period) % period;
+
+        bool wasMovingBackward = isMovingBackward;
+
+        isMovingBackward = (newPhase >= size - 1);
+        distanceFromBeginToIter = (isMovingBackward ? period - newPhase : newPhase);
+        distanceFromIterToEnd = size - distanceFromBeginToIter;
+
+        if(isMovingBackward != wasMovingBackward ||
+           howManyStepsToAdvanceIter >= period ||
+           -howManyStepsToAdvanceIter >= period)
+        {
+            return blAdvanceWrapped;
+        }
+
+        return blAdvanceStepped;
+    }
+
+    // How far iter1 has to advance
+    // to get to iter2's position
+    // and direction, in [0,2*(n-1))
+
+    static ptrdiff_t    distance(const ptrdiff_t& distanceFromBeginToIter1,
+                                 const ptrdiff_t& distanceFromBeginToIter2,
+                                 const ptrdiff_t& distanceFromIterToEnd1,
+                                 const ptrdiff_t& distanceFromIterToEnd2,
+                                 const blAdvanceStateType& isMovingBackward1,
+                                 const blAdvanceStateType& isMovingBackward2)
+    {
+        ptrdiff_t size = distanceFromBeginToIter1 + distanceFromIterToEnd1;
+        ptrdiff_t period = 2 * (size - 1);
+
+        if(period <= 0 || distanceFromIterToEnd1 == 0 || distanceFromIterToEnd2 == 0)
+            return ( distanceFromBeginToIter2 - distanceFromBeginToIter1 );
+
+        return ( (getPhase(distanceFromBeginToIter2,isMovingBackward2,size) -
+                  getPhase(distanceFromBeginToIter1,isMovingBackward1,size) +
+                  period) % period );
+    }
+
+    // The phase of a position
+    // and direction
+
+    static ptrdiff_t    getPhase(const ptrdiff_t& distanceFromBeginToIter,
+                                 const blAdvanceStateType& isMovingBackward,
+                                 const ptrdiff_t& size)
+    {
+        ptrdiff_t period = 2 * (size - 1);
+
+        return (isMovingBackward ? (period - distanceFromBeginToIter) % period : distanceFromBeginToIter);
+    }
+};
+//-------------------------------------------------------------------
+
 #endif // BL_ITERATORFUNCTORS_HPP
@@ -0,0 +1,422 @@
+#ifndef BL_ITERATORINSTRUMENTATION_HPP
+#define BL_ITERATORINSTRUMENTATION_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blIteratorInstrumentation.hpp
+// CLASS:           blNoInstrumentation
+//                  blCountingInstrumentation
+//                  blIteratorCounters
+// BASE CLASS:      None
+//
+// PURPOSE:         Instrumentation policies for blIterator.
+//
+//                  Every time a blIterator advances, it calls
+//                  its instrumentation policy's static function:
+//
+//                  - onAdvance(howManySteps,event)
+//
+//                  where "event" tells whether the advance was a
+//                  plain step, got clamped at the begin/end or
+//                  wrapped around (see blAdvanceEvent).
+//
+//                  - blNoInstrumentation -- The default policy,
+//                                           it does nothing and
+//                                           compiles away.
+//
+//                  - blCountingInstrumentation -- Counts increments,
+//                                                 decrements, jumps,
+//                                                 wraps, clamps and
+//                                                 keeps a histogram of
+//                                                 the advance distances.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - std::atomic, std::mutex
+//
+// NOTES:           - Every thread counts into its own counters,
+//                    which are only added together when the
+//                    counters are asked for, so counting does
+//                    not make threads fight over a cache line
+//
+//                  - Different iterators can be counted
+//                    separately by giving each of them its
+//                    own tag type:
+//
+//                    blCountingInstrumentation<myTag>
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The default instrumentation
+// policy which does nothing
+//-------------------------------------------------------------------
+struct blNoInstrumentation
+{
+    static void                                             onAdvance(const ptrdiff_t&,
+                                                                      const blAdvanceEvent&)
+    {
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The number of bins of the advance
+// distance histogram
+//
+// NOTE:    Bin "k" counts the advances
+//          whose absolute distance is
+//          in [2^k,2^(k+1)), the first
+//          bin also counts zero distance
+//          advances and the last bin
+//          counts everything bigger
+//-------------------------------------------------------------------
+const size_t                                                blAdvanceHistogramSize = 32;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// A snapshot of the counters
+//-------------------------------------------------------------------
+struct blIteratorCounters
+{
+    blIteratorCounters()
+    {
+        m_increments = 0;
+        m_decrements = 0;
+        m_jumps = 0;
+        m_wraps = 0;
+        m_clamps = 0;
+
+        for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+            m_advanceDistanceHistogram[i] = 0;
+    }
+
+    blIteratorCounters&                                     operator+=(const blIteratorCounters& counters)
+    {
+        m_increments += counters.m_increments;
+        m_decrements += counters.m_decrements;
+        m_jumps += counters.m_jumps;
+        m_wraps += counters.m_wraps;
+        m_clamps += counters.m_clamps;
+
+        for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+            m_advanceDistanceHistogram[i] += counters.m_advanceDistanceHistogram[i];
+
+        return (*this);
+    }
+
+    // Functions used to
+    // export the counters
+
+    std::string                                             toText()const;
+    std::string                                             toJSON()const;
+
+    // Function used to
+    // get the histogram
+    // bin of an advance
+    // distance
+
+    static size_t                                           getHistogramBin(const ptrdiff_t& howManySteps);
+
+    // The counters
+
+    uint64_t                                                m_increments;
+    uint64_t                                                m_decrements;
+    uint64_t                                                m_jumps;
+    uint64_t                                                m_wraps;
+    uint64_t                                                m_clamps;
+
+    uint64_t                                                m_advanceDistanceHistogram[blAdvanceHistogramSize];
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline size_t blIteratorCounters::getHistogramBin(const ptrdiff_t& howManySteps)
+{
+    uint64_t distance = static_cast<uint64_t>(howManySteps < 0 ? -howManySteps : howManySteps);
+
+    size_t bin = 0;
+
+    while(distance > 1 && bin < blAdvanceHistogramSize - 1)
+    {
+        distance >>= 1;
+        ++bin;
+    }
+
+    return bin;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline std::string blIteratorCounters::toText()const
+{
+    std::string text;
+
+    text += "increments: " + std::to_string(m_increments) + "\n";
+    text += "decrements: " + std::to_string(m_decrements) + "\n";
+    text += "jumps: " + std::to_string(m_jumps) + "\n";
+    text += "wraps: " + std::to_string(m_wraps) + "\n";
+    text += "clamps: " + std::to_string(m_clamps) + "\n";
+    text += "advance distance histogram:\n";
+
+    for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+    {
+        if(m_advanceDistanceHistogram[i] == 0)
+            continue;
+
+        text += "  [" + std::to_string(i == 0 ? 0 : (uint64_t(1) << i)) + ",";
+
+        if(i == blAdvanceHistogramSize - 1)
+            text += "inf): ";
+        else
+            text += std::to_string(uint64_t(1) << (i + 1)) + "): ";
+
+        text += std::to_string(m_advanceDistanceHistogram[i]) + "\n";
+    }
+
+    return text;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+inline std::string blIteratorCounters::toJSON()const
+{
+    std::string json;
+
+    json += "{\"increments\":" + std::to_string(m_increments);
+    json += ",\"decrements\":" + std::to_string(m_decrements);
+    json += ",\"jumps\":" + std::to_string(m_jumps);
+    json += ",\"wraps\":" + std::to_string(m_wraps);
+    json += ",\"clamps\":" + std::to_string(m_clamps);
+    json += ",\"advanceDistanceHistogram\":[";
+
+    for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+    {
+        if(i > 0)
+            json += ",";
+
+        json += std::to_string(m_advanceDistanceHistogram[i]);
+    }
+
+    json += "]}";
+
+    return json;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The counters owned by one thread
+//
+// NOTE:    Only the owning thread writes
+//          to them, so a relaxed load and
+//          store is enough to count (no
+//          locked instruction), while the
+//          atomics still let other threads
+//          read them safely
+//-------------------------------------------------------------------
+struct blThreadIteratorCounters
+{
+    blThreadIteratorCounters()
+    {
+        reset();
+    }
+
+    static void                                             increment(std::atomic<uint64_t>& counter)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1,std::memory_order_relaxed);
+    }
+
+    void                                                    reset()
+    {
+        m_increments.store(0,std::memory_order_relaxed);
+        m_decrements.store(0,std::memory_order_relaxed);
+        m_jumps.store(0,std::memory_order_relaxed);
+        m_wraps.store(0,std::memory_order_relaxed);
+        m_clamps.store(0,std::memory_order_relaxed);
+
+        for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+            m_advanceDistanceHistogram[i].store(0,std::memory_order_relaxed);
+    }
+
+    blIteratorCounters                                      getSnapshot()const
+    {
+        blIteratorCounters counters;
+
+        counters.m_increments = m_increments.load(std::memory_order_relaxed);
+        counters.m_decrements = m_decrements.load(std::memory_order_relaxed);
+        counters.m_jumps = m_jumps.load(std::memory_order_relaxed);
+        counters.m_wraps = m_wraps.load(std::memory_order_relaxed);
+        counters.m_clamps = m_clamps.load(std::memory_order_relaxed);
+
+        for(size_t i = 0; i < blAdvanceHistogramSize; ++i)
+            counters.m_advanceDistanceHistogram[i] = m_advanceDistanceHistogram[i].load(std::memory_order_relaxed);
+
+        return counters;
+    }
+
+    std::atomic<uint64_t>                                   m_increments;
+    std::atomic<uint64_t>                                   m_decrements;
+    std::atomic<uint64_t>                                   m_jumps;
+    std::atomic<uint64_t>                                   m_wraps;
+    std::atomic<uint64_t>                                   m_clamps;
+
+    std::atomic<uint64_t>                                   m_advanceDistanceHistogram[blAdvanceHistogramSize];
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Instrumentation policy counting
+// how iterators advance
+//-------------------------------------------------------------------
+template<typename blTagType = void>
+
+struct blCountingInstrumentation
+{
+public: // Public functions
+
+    // Function called by
+    // blIterator every time
+    // it advances
+
+    static void                                             onAdvance(const ptrdiff_t& howManySteps,
+                                                                      const blAdvanceEvent& event)
+    {
+        blThreadIteratorCounters& counters = getThreadCounters();
+
+        if(howManySteps == 1)
+            blThreadIteratorCounters::increment(counters.m_increments);
+        else if(howManySteps == -1)
+            blThreadIteratorCounters::increment(counters.m_decrements);
+        else
+            blThreadIteratorCounters::increment(counters.m_jumps);
+
+        if(event == blAdvanceWrapped)
+            blThreadIteratorCounters::increment(counters.m_wraps);
+        else if(event == blAdvanceClamped)
+            blThreadIteratorCounters::increment(counters.m_clamps);
+
+        blThreadIteratorCounters::increment(counters.m_advanceDistanceHistogram[blIteratorCounters::getHistogramBin(howManySteps)]);
+    }
+
+    // Function used to add
+    // together the counters
+    // of all the threads
+    // (including the threads
+    // that already exited)
+
+    static blIteratorCounters                               getCounters()
+    {
+        blRegistry& registry = getRegistry();
+
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+        blIteratorCounters counters = registry.m_exitedThreadsCounters;
+
+        for(size_t i = 0; i < registry.m_threadsCounters.size(); ++i)
+            counters += registry.m_threadsCounters[i]->getSnapshot();
+
+        return counters;
+    }
+
+    // Function used to
+    // zero all the counters
+    //
+    // NOTE:    Increments made by other
+    //          threads while resetting
+    //          might be lost
+
+    static void                                             resetCounters()
+    {
+        blRegistry& registry = getRegistry();
+
+        std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+        registry.m_exitedThreadsCounters = blIteratorCounters();
+
+        for(size_t i = 0; i < registry.m_threadsCounters.size(); ++i)
+            registry.m_threadsCounters[i]->reset();
+    }
+
+private: // Private types
+
+    // The list of the
+    // live threads' counters
+    // and the totals of the
+    // threads that exited
+
+    struct blRegistry
+    {
+        std::mutex                                          m_mutex;
+        std::vector<blThreadIteratorCounters*>              m_threadsCounters;
+        blIteratorCounters                                  m_exitedThreadsCounters;
+    };
+
+    // A thread's counters,
+    // registered on creation
+    // and folded into the
+    // totals when the thread
+    // exits
+
+    struct blRegisteredThreadCounters
+    {
+        blRegisteredThreadCounters()
+        {
+            blRegistry& registry = getRegistry();
+
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+            registry.m_threadsCounters.push_back(&m_counters);
+        }
+
+        ~blRegisteredThreadCounters()
+        {
+            blRegistry& registry = getRegistry();
+
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+            registry.m_exitedThreadsCounters += m_counters.getSnapshot();
+
+            registry.m_threadsCounters.erase(std::find(registry.m_threadsCounters.begin(),
+                                                       registry.m_threadsCounters.end(),
+                                                       &m_counters));
+        }
+
+        blThreadIteratorCounters                            m_counters;
+    };
+
+private: // Private functions
+
+    static blRegistry&                                      getRegistry()
+    {
+        static blRegistry registry;
+
+        return registry;
+    }
+
+    static blThreadIteratorCounters&                        getThreadCounters()
+    {
+        static thread_local blRegisteredThreadCounters threadCounters;
+
+        return threadCounters.m_counters;
+    }
+};
+//-------------------------------------------------------------------
+
+
+#endif // BL_ITERATORINSTRUMENTATION_HPP
@@ -0,0 +1,190 @@
+#ifndef BL_ITERATORTRAITS_HPP
+#define BL_ITERATORTRAITS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blIteratorTraits.hpp
+// CLASS:           blIsContiguousIterator
+//                  blIsContiguousContainer
+//                  blIsSegmentedIterator
+// BASE CLASS:      None
+//
+// PURPOSE:         Traits used to know whether an iterator
+//                  walks through contiguous memory, so that
+//                  the library can hand out raw pointers to
+//                  whole segments of a container instead of
+//                  going through it one element at a time.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawIterator
+//
+// NOTES:           - Users can specialize blIsContiguousIterator
+//                    for their own iterators, or
+//                    blIsContiguousContainer for their own
+//                    containers whose iterator and const_iterator
+//                    walk forward through contiguous memory
+//
+//                  - Reverse iterators are never considered
+//                    contiguous, because they walk memory
+//                    backwards
+//
+//                  - Segmented iterators (blSegmentedArray's for
+//                    example) walk forward through blocks of
+//                    contiguous memory, they have to provide
+//                    "getPtr()" and "getBlockEnd()", the
+//                    pointers to their element and to the end
+//                    of its block
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Iterators that walk forward
+// through contiguous memory
+//-------------------------------------------------------------------
+template<typename blIteratorType>
+struct blIsContiguousIterator : std::false_type
+{
+};
+
+template<typename blDataType>
+struct blIsContiguousIterator<blDataType*> : std::true_type
+{
+};
+
+template<typename blDataType>
+struct blIsContiguousIterator< blRawIterator<blDataType> > : std::true_type
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Containers whose "iterator" and
+// "const_iterator" walk forward
+// through contiguous memory
+//-------------------------------------------------------------------
+template<typename blContainerType>
+struct blIsContiguousContainer : std::false_type
+{
+};
+
+template<typename blDataType,typename blAllocatorType>
+struct blIsContiguousContainer< std::vector<blDataType,blAllocatorType> > : std::integral_constant<bool,!std::is_same<blDataType,bool>::value>
+{
+};
+
+template<typename blDataType,size_t blArraySize>
+struct blIsContiguousContainer< std::array<blDataType,blArraySize> > : std::true_type
+{
+};
+
+template<typename blCharType,typename blTraitsType,typename blAllocatorType>
+struct blIsContiguousContainer< std::basic_string<blCharType,blTraitsType,blAllocatorType> > : std::true_type
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Used to know whether a container's
+// iterator (for example the one returned
+// by a blBeginEndFunctor) walks forward
+// through contiguous memory
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blIteratorType>
+struct blIsContiguousRange : std::integral_constant<bool,
+                                                    blIsContiguousIterator<blIteratorType>::value ||
+                                                    (
+                                                     blIsContiguousContainer<typename std::remove_const<blContainerType>::type>::value &&
+                                                     (
+                                                      std::is_same<blIteratorType,typename blContainerType::iterator>::value ||
+                                                      std::is_same<blIteratorType,typename blContainerType::const_iterator>::value
+                                                     )
+                                                    )>
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Iterators that walk forward through
+// blocks of contiguous memory
+//-------------------------------------------------------------------
+template<typename blIteratorType>
+struct blIsSegmentedIterator : std::false_type
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get how many of the
+// next "maxLength" elements starting at
+// an iterator are contiguous in memory
+//-------------------------------------------------------------------
+template<typename blIteratorType>
+inline ptrdiff_t getContiguousLength(const blIteratorType&,
+                                     const ptrdiff_t& maxLength,
+                                     std::false_type)
+{
+    return maxLength;
+}
+
+template<typename blIteratorType>
+inline ptrdiff_t getContiguousLength(const blIteratorType& iter,
+                                     const ptrdiff_t& maxLength,
+                                     std::true_type)
+{
+    ptrdiff_t blockLength = iter.getBlockEnd() - iter.getPtr();
+
+    return (maxLength < blockLength ? maxLength : blockLength);
+}
+
+template<typename blIteratorType>
+inline ptrdiff_t getContiguousLength(const blIteratorType& iter,
+                                     const ptrdiff_t& maxLength)
+{
+    return getContiguousLength(iter,maxLength,blIsSegmentedIterator<blIteratorType>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get the raw pointer
+// of the element an iterator points to
+//
+// NOTE:    For iterators other than raw
+//          pointers and blRawIterators, the
+//          iterator has to be dereferenceable
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blDataType* getDataPointer(blDataType* ptr)
+{
+    return ptr;
+}
+
+template<typename blDataType>
+inline blDataType* getDataPointer(const blRawIterator<blDataType>& rawIterator)
+{
+    return rawIterator.getPtr();
+}
+
+template<typename blIteratorType>
+inline auto getDataPointer(const blIteratorType& iter)->decltype(std::addressof(*iter))
+{
+    return std::addressof(*iter);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_ITERATORTRAITS_HPP
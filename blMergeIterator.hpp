@@ -0,0 +1,411 @@
+#ifndef BL_MERGEITERATOR_HPP
+#define BL_MERGEITERATOR_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blMergeIterator.hpp
+// CLASS:           blMergeIterator
+// BASE CLASS:      None
+//
+// PURPOSE:         An input iterator merging K sorted ranges
+//                  (raw pointers, blRawArrayWrappers, blIterator
+//                  ranges, ...) into one ordered stream.
+//
+//                  The ranges are the leaves of a tournament
+//                  "loser" tree, whose internal nodes remember
+//                  the loser of the match played there, so
+//                  taking the smallest element only replays the
+//                  log2(K) matches on the path from its leaf to
+//                  the root, comparing against the stored losers
+//                  without looking at the siblings (unlike a
+//                  binary heap, which compares both children on
+//                  every level), and each match picks its winner
+//                  without a branch.
+//
+//                  "fill" writes the next merged elements into
+//                  a buffer (raw array, blRawArrayWrapper or
+//                  blArray), which keeps the tree's state in
+//                  local variables for the whole batch.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper
+//                  - blArray
+//
+// NOTES:           - The merge is stable, equal elements come
+//                    out in the order of their ranges
+//
+//                  - The elements have to be default constructible
+//                    and copyable, since each range's current element
+//                    is copied into the tree
+//
+//                  - Merge iterators only compare as done or not
+//                    done, so the only meaningful comparison is
+//                    against an "end" iterator, which is default
+//                    constructed or (for comparators that aren't
+//                    default constructible, like lambdas) made
+//                    from just the comparator, "done()" and the
+//                    bool operator are the same test
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,
+         typename blCompareType = std::less<typename std::iterator_traits<blIteratorType>::value_type> >
+
+class blMergeIterator : public std::iterator<std::input_iterator_tag,
+                                             typename std::iterator_traits<blIteratorType>::value_type,
+                                             ptrdiff_t,
+                                             const typename std::iterator_traits<blIteratorType>::value_type*,
+                                             const typename std::iterator_traits<blIteratorType>::value_type&>
+{
+public: // Public typedefs
+
+    typedef typename std::iterator_traits<blIteratorType>::value_type       blDataType;
+    typedef std::pair<blIteratorType,blIteratorType>                        blRangeType;
+
+public: // Constructors and destructors
+
+    // Default constructor,
+    // giving an "end" iterator
+
+    blMergeIterator() = default;
+
+    // Constructor giving an
+    // "end" iterator for
+    // comparators that can't
+    // be default constructed
+
+    explicit blMergeIterator(const blCompareType& compare) : m_compare(compare)
+    {
+    }
+
+    // Constructor from the
+    // sorted ranges to merge
+
+    blMergeIterator(const std::vector<blRangeType>& ranges,
+                    const blCompareType& compare = blCompareType());
+
+    // Copy constructor
+
+    blMergeIterator(const blMergeIterator<blIteratorType,blCompareType>& mergeIterator) = default;
+
+    // Destructor
+
+    ~blMergeIterator(){}
+
+public: // Overloaded operators
+
+    blMergeIterator<blIteratorType,blCompareType>&          operator=(const blMergeIterator<blIteratorType,blCompareType>& mergeIterator) = default;
+
+    // Iterators are equal when
+    // both are (or both aren't)
+    // done, see NOTES
+
+    bool                                                    operator==(const blMergeIterator<blIteratorType,blCompareType>& mergeIterator)const{return (this->done() == mergeIterator.done());}
+    bool                                                    operator!=(const blMergeIterator<blIteratorType,blCompareType>& mergeIterator)const{return (this->done() != mergeIterator.done());}
+
+    explicit operator                                       bool()const{return (m_numberOfRemainingElements > 0);}
+
+    // Dereferencing gives the
+    // smallest remaining element
+
+    const blDataType&                                       operator*()const{return m_keys[m_losers[0]];}
+    const blDataType*                                       operator->()const{return std::addressof(m_keys[m_losers[0]]);}
+
+    blMergeIterator<blIteratorType,blCompareType>&          operator++(){this->pop();return (*this);}
+    blMergeIterator<blIteratorType,blCompareType>           operator++(int){auto temp(*this);this->pop();return temp;}
+
+public: // Public functions
+
+    // Functions used to write
+    // the next (up to) "n" merged
+    // elements into a buffer,
+    // returning how many were
+    // written
+
+    size_t                                                  fill(blDataType* output,
+                                                                 const size_t& n);
+
+    size_t                                                  fill(blRawArrayWrapper<blDataType> output){return this->fill(output.begin().getPtr(),output.size());}
+
+    template<size_t blArraySize,size_t blAlignment>
+    size_t                                                  fill(blArray<blDataType,blArraySize,blAlignment>& output){return this->fill(output.data(),blArraySize);}
+
+    // Functions used to get
+    // the number of elements
+    // left to merge
+
+    size_t                                                  size()const{return m_numberOfRemainingElements;}
+    bool                                                    empty()const{return (m_numberOfRemainingElements == 0);}
+    bool                                                    done()const{return (m_numberOfRemainingElements == 0);}
+
+    size_t                                                  getNumberOfRanges()const{return m_numberOfRanges;}
+
+    // The index of the range
+    // the current element
+    // comes from
+
+    size_t                                                  getRangeIndex()const{return m_losers[0];}
+
+private: // Private functions
+
+    // Function used to know
+    // whether the leaf "a"
+    // wins against the leaf "b"
+    // (ties go to the first
+    // range, so the merge is
+    // stable)
+
+    bool                                                    wins(const size_t& a,
+                                                                 const size_t& b)const
+    {
+        // Exhausted leaves lose
+        // against anything
+
+        if(m_isExhausted[a] | m_isExhausted[b])
+            return !m_isExhausted[a];
+
+        // Evaluated without short
+        // circuits, so the result
+        // can be used without a
+        // branch
+
+        return ( m_compare(m_keys[a],m_keys[b]) |
+                 (!m_compare(m_keys[b],m_keys[a]) & (a < b)) );
+    }
+
+    // Function used to move a
+    // leaf to its next element
+
+    void                                                    advanceLeaf(const size_t& leaf)
+    {
+        if(++m_iterators[leaf] == m_ends[leaf])
+            m_isExhausted[leaf] = 1;
+        else
+            m_keys[leaf] = *m_iterators[leaf];
+    }
+
+    // Function used to replay
+    // the matches from a leaf
+    // up to the root
+
+    void                                                    replay(size_t winner)
+    {
+        for(size_t node = (winner + m_numberOfLeaves) / 2; node > 0; node /= 2)
+            this->playMatch(node,winner);
+
+        m_losers[0] = winner;
+    }
+
+    // Function used to play the
+    // match of a node, where the
+    // loser stays and the winner
+    // goes on (selected without
+    // branches, since which one
+    // wins is unpredictable)
+
+    void                                                    playMatch(const size_t& node,
+                                                                      size_t& winner)
+    {
+        size_t loser = m_losers[node];
+        size_t swapMask = (loser ^ winner) & (size_t(0) - static_cast<size_t>(this->wins(loser,winner)));
+
+        m_losers[node] = loser ^ swapMask;
+        winner ^= swapMask;
+    }
+
+    // Function used to take
+    // the smallest element
+
+    void                                                    pop()
+    {
+        if(m_numberOfRemainingElements == 0)
+            return;
+
+        this->advanceLeaf(m_losers[0]);
+
+        --m_numberOfRemainingElements;
+
+        this->replay(m_losers[0]);
+    }
+
+    // Function used to play
+    // the whole tournament
+
+    void                                                    build();
+
+private: // Private variables
+
+    // The leaves, each one a range's
+    // iterators and a copy of its
+    // current element (kept next to
+    // each other for the matches),
+    // padded to a power of two with
+    // exhausted leaves
+
+    std::vector<blIteratorType>                             m_iterators;
+    std::vector<blIteratorType>                             m_ends;
+    std::vector<blDataType>                                 m_keys;
+    std::vector<unsigned char>                              m_isExhausted;
+
+    // The losers of each match,
+    // with the overall winner at
+    // index zero
+
+    std::vector<size_t>                                     m_losers;
+
+    size_t                                                  m_numberOfRanges = 0;
+    size_t                                                  m_numberOfLeaves = 0;
+    size_t                                                  m_numberOfRemainingElements = 0;
+
+    blCompareType                                           m_compare;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,typename blCompareType>
+inline blMergeIterator<blIteratorType,blCompareType>::blMergeIterator(const std::vector<blRangeType>& ranges,
+                                                                      const blCompareType& compare)
+                                                                      : m_numberOfRanges(ranges.size()),
+                                                                        m_compare(compare)
+{
+    m_numberOfLeaves = 1;
+
+    while(m_numberOfLeaves < m_numberOfRanges)
+        m_numberOfLeaves *= 2;
+
+    m_iterators.reserve(m_numberOfRanges);
+    m_ends.reserve(m_numberOfRanges);
+    m_keys.resize(m_numberOfRanges);
+    m_isExhausted.assign(m_numberOfLeaves,1);
+
+    for(size_t i = 0; i < m_numberOfRanges; ++i)
+    {
+        m_iterators.push_back(ranges[i].first);
+        m_ends.push_back(ranges[i].second);
+
+        if(ranges[i].first != ranges[i].second)
+        {
+            m_keys[i] = *ranges[i].first;
+            m_isExhausted[i] = 0;
+        }
+
+        m_numberOfRemainingElements += static_cast<size_t>(std::distance(ranges[i].first,ranges[i].second));
+    }
+
+    this->build();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,typename blCompareType>
+inline void blMergeIterator<blIteratorType,blCompareType>::build()
+{
+    // Each node's winner moves up
+    // while its loser stays, so the
+    // winners are kept in a scratch
+    // tree laid out like the losers,
+    // with the leaves after the
+    // internal nodes
+
+    m_losers.assign(m_numberOfLeaves,0);
+
+    std::vector<size_t> winners(2 * m_numberOfLeaves);
+
+    for(size_t i = 0; i < m_numberOfLeaves; ++i)
+        winners[m_numberOfLeaves + i] = i;
+
+    for(size_t node = m_numberOfLeaves - 1; node > 0; --node)
+    {
+        size_t left = winners[2 * node];
+        size_t right = winners[2 * node + 1];
+
+        if(this->wins(right,left))
+            std::swap(left,right);
+
+        winners[node] = left;
+        m_losers[node] = right;
+    }
+
+    m_losers[0] = winners[1];
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blIteratorType,typename blCompareType>
+inline size_t blMergeIterator<blIteratorType,blCompareType>::fill(blDataType* output,
+                                                                  const size_t& n)
+{
+    size_t numberOfElements = (n < m_numberOfRemainingElements ? n : m_numberOfRemainingElements);
+
+    if(numberOfElements == 0)
+        return 0;
+
+    size_t winner = m_losers[0];
+
+    for(size_t i = 0; i < numberOfElements; ++i)
+    {
+        output[i] = m_keys[winner];
+
+        this->advanceLeaf(winner);
+
+        // The replay, keeping
+        // the winner local
+
+        for(size_t node = (winner + m_numberOfLeaves) / 2; node > 0; node /= 2)
+            this->playMatch(node,winner);
+    }
+
+    m_losers[0] = winner;
+    m_numberOfRemainingElements -= numberOfElements;
+
+    return numberOfElements;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get a merge
+// iterator over sorted buffers
+//-------------------------------------------------------------------
+template<typename blDataType,typename blCompareType = std::less<blDataType> >
+inline blMergeIterator<const blDataType*,blCompareType> getMergeIterator(const std::vector< blRawArrayWrapper<blDataType> >& buffers,
+                                                                         const blCompareType& compare = blCompareType())
+{
+    std::vector< std::pair<const blDataType*,const blDataType*> > ranges;
+
+    ranges.reserve(buffers.size());
+
+    for(const auto& buffer : buffers)
+    {
+        const blDataType* first = buffer.cbegin().getPtr();
+
+        ranges.emplace_back(first,first + buffer.size());
+    }
+
+    return blMergeIterator<const blDataType*,blCompareType>(ranges,compare);
+}
+
+template<typename blIteratorType,typename blCompareType = std::less<typename std::iterator_traits<blIteratorType>::value_type> >
+inline blMergeIterator<blIteratorType,blCompareType> getMergeIterator(const std::vector< std::pair<blIteratorType,blIteratorType> >& ranges,
+                                                                      const blCompareType& compare = blCompareType())
+{
+    return blMergeIterator<blIteratorType,blCompareType>(ranges,compare);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_MERGEITERATOR_HPP
@@ -0,0 +1,554 @@
+#ifndef BL_MIRROREDRINGBUFFER_HPP
+#define BL_MIRROREDRINGBUFFER_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blMirroredRingBuffer.hpp
+// CLASS:           blMirroredRingBuffer
+// BASE CLASS:      None
+//
+// PURPOSE:         A ring buffer whose storage is mapped twice,
+//                  back to back, in virtual memory, so the same
+//                  physical pages are seen at "data" and at
+//                  "data + capacity".
+//
+//                  Any window of up to "capacity" elements,
+//                  starting anywhere in the ring, is therefore
+//                  one contiguous span, and consumers never
+//                  have to split their reads or writes at the
+//                  wrap.
+//
+//                  The buffer's iterators are raw iterators
+//                  over its contents, from the oldest to the
+//                  newest element, so the buffer can be used
+//                  with blLinearIterator, blCircularIterator
+//                  and their batched next_n.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - memfd_create and mmap (on Linux)
+//                  - blRawArrayWrapper
+//
+// NOTES:           - The capacity is rounded up so that the
+//                    storage is a whole number of pages
+//
+//                  - When the pages can't be mirrored (on other
+//                    platforms, or when memfd_create/mmap fail),
+//                    the buffer falls back to an ordinary
+//                    allocation of twice the capacity, and every
+//                    write made through the buffer's functions
+//                    is copied to both halves.  Elements written
+//                    in place through iterators or operator[]
+//                    are then only mirrored after calling
+//                    "syncMirror"
+//
+//                  - Only trivially copyable elements are
+//                    supported
+//
+//                  - The buffer uses the same overflow policies
+//                    as blCircularBuffer
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,
+         typename blOverflowPolicyType = blOverwriteWhenFull>
+
+class blMirroredRingBuffer
+{
+    static_assert(std::is_trivially_copyable<blDataType>::value,
+                  "blMirroredRingBuffer only supports trivially copyable elements");
+
+public: // Public typedefs
+
+    typedef blDataType                                      value_type;
+
+    typedef blRawIterator<blDataType>                       iterator;
+    typedef blRawIterator<const blDataType>                 const_iterator;
+
+    typedef blRawReverseIterator<blDataType>                reverse_iterator;
+    typedef blRawReverseIterator<const blDataType>          const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    // Constructor creating a buffer
+    // of at least the specified
+    // capacity
+
+    blMirroredRingBuffer(const size_t& minimumCapacity);
+
+    // Move constructor
+
+    blMirroredRingBuffer(blMirroredRingBuffer<blDataType,blOverflowPolicyType>&& ringBuffer);
+
+    // The mapped storage is
+    // owned by the buffer, so
+    // it cannot be copied
+
+    blMirroredRingBuffer(const blMirroredRingBuffer<blDataType,blOverflowPolicyType>& ringBuffer) = delete;
+
+    // Destructor
+
+    ~blMirroredRingBuffer();
+
+public: // Assignment operators
+
+    blMirroredRingBuffer<blDataType,blOverflowPolicyType>&  operator=(const blMirroredRingBuffer<blDataType,blOverflowPolicyType>& ringBuffer) = delete;
+
+public: // Public functions
+
+    // Element access
+    // functions using
+    // logical indices
+    // (0 is the oldest
+    // element)
+
+    blDataType&                                             operator[](const size_t elementIndex){return m_data[m_head + elementIndex];}
+    const blDataType&                                       operator[](const size_t elementIndex)const{return m_data[m_head + elementIndex];}
+
+    // Functions used
+    // to return the
+    // buffer size
+
+    size_t                                                  length()const{return m_size;}
+    size_t                                                  size()const{return m_size;}
+    size_t                                                  max_size()const{return m_capacity;}
+    size_t                                                  capacity()const{return m_capacity;}
+    bool                                                    empty()const{return (m_size == 0);}
+    bool                                                    full()const{return (m_size == m_capacity);}
+
+    // Function used to know
+    // whether the pages are
+    // really mirrored or the
+    // buffer fell back to
+    // mirrored writes
+
+    bool                                                    isMirrored()const{return m_isMirrored;}
+
+    // Function used to
+    // empty the buffer
+
+    void                                                    clear(){m_head = 0;m_size = 0;}
+
+    // Functions used to push
+    // one element or a span
+    // of elements, they return
+    // how many elements were
+    // pushed
+
+    bool                                                    push_back(const blDataType& value){return (push_back(&value,1) == 1);}
+
+    size_t                                                  push_back(const blDataType* values,
+                                                                      const size_t& numberOfValues);
+
+    // Function used to drop
+    // up to "numberOfValues"
+    // oldest elements, it
+    // returns how many were
+    // dropped
+
+    size_t                                                  consume(const size_t& numberOfValues);
+
+    // Functions used to get
+    // a contiguous span of
+    // the elements, starting
+    // "offset" elements after
+    // the oldest one
+
+    blRawArrayWrapper<blDataType>                           getReadSpan(){return getReadSpan(0,m_size);}
+    blRawArrayWrapper<blDataType>                           getReadSpan(const size_t& offset,
+                                                                        const size_t& numberOfValues);
+
+    // Functions used by producers
+    // to write directly into the
+    // buffer's free space, and
+    // then to add the written
+    // elements to the buffer
+
+    blRawArrayWrapper<blDataType>                           getWriteSpan(){return blRawArrayWrapper<blDataType>(m_data + m_head + m_size,m_capacity - m_size);}
+    void                                                    commitWrite(const size_t& numberOfValues);
+
+    // Function used to mirror
+    // the buffer's elements
+    // when the pages are not
+    // mirrored (it does nothing
+    // otherwise)
+
+    void                                                    syncMirror();
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(m_data + m_head);}
+    iterator                                                end(){return iterator(m_data + m_head + m_size);}
+    const_iterator                                          cbegin()const{return const_iterator(m_data + m_head);}
+    const_iterator                                          cend()const{return const_iterator(m_data + m_head + m_size);}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(m_data + m_head + m_size - 1);}
+    reverse_iterator                                        rend(){return reverse_iterator(m_data + m_head - 1);}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(m_data + m_head + m_size - 1);}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(m_data + m_head - 1);}
+
+private: // Private functions
+
+    // Functions used to
+    // create and release
+    // the storage
+
+    bool                                                    mapMirroredPages(const size_t& minimumCapacity);
+    void                                                    allocateFallbackStorage(const size_t& minimumCapacity);
+    void                                                    releaseStorage();
+
+    // Function used to write
+    // values to the physical
+    // position "position" of
+    // the storage, mirroring
+    // them when needed
+
+    void                                                    writeValues(const size_t& position,
+                                                                        const blDataType* values,
+                                                                        const size_t& numberOfValues);
+
+    void                                                    mirrorValues(const size_t& position,
+                                                                         const size_t& numberOfValues);
+
+    // Functions used to get
+    // how many values can be
+    // pushed when the buffer
+    // is full
+
+    size_t                                                  getNumberOfValuesToPush(const size_t& numberOfValues,blOverwriteWhenFull)const{return numberOfValues;}
+    size_t                                                  getNumberOfValuesToPush(const size_t& numberOfValues,blRejectWhenFull)const{return std::min(numberOfValues,m_capacity - m_size);}
+
+private: // Private variables
+
+    // The storage, which is
+    // "2 * capacity" elements
+    // long
+
+    blDataType*                                             m_data;
+    size_t                                                  m_capacity;
+    bool                                                    m_isMirrored;
+
+    // The position of the
+    // oldest element and the
+    // number of elements
+
+    size_t                                                  m_head;
+    size_t                                                  m_size;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline blMirroredRingBuffer<blDataType,blOverflowPolicyType>::blMirroredRingBuffer(const size_t& minimumCapacity)
+{
+    m_data = nullptr;
+    m_capacity = 0;
+    m_isMirrored = false;
+    m_head = 0;
+    m_size = 0;
+
+    if(minimumCapacity == 0)
+        return;
+
+    if(!mapMirroredPages(minimumCapacity))
+        allocateFallbackStorage(minimumCapacity);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline blMirroredRingBuffer<blDataType,blOverflowPolicyType>::blMirroredRingBuffer(blMirroredRingBuffer<blDataType,blOverflowPolicyType>&& ringBuffer)
+{
+    m_data = ringBuffer.m_data;
+    m_capacity = ringBuffer.m_capacity;
+    m_isMirrored = ringBuffer.m_isMirrored;
+    m_head = ringBuffer.m_head;
+    m_size = ringBuffer.m_size;
+
+    ringBuffer.m_data = nullptr;
+    ringBuffer.m_capacity = 0;
+    ringBuffer.m_head = 0;
+    ringBuffer.m_size = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline blMirroredRingBuffer<blDataType,blOverflowPolicyType>::~blMirroredRingBuffer()
+{
+    releaseStorage();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline bool blMirroredRingBuffer<blDataType,blOverflowPolicyType>::mapMirroredPages(const size_t& minimumCapacity)
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+
+    // The storage has to be a
+    // whole number of pages and
+    // a whole number of elements
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    size_t storageSize = ((minimumCapacity * sizeof(blDataType) + pageSize - 1) / pageSize) * pageSize;
+
+    while(storageSize % sizeof(blDataType) != 0)
+        storageSize += pageSize;
+
+    int fileDescriptor = static_cast<int>(syscall(SYS_memfd_create,"blMirroredRingBuffer",0));
+
+    if(fileDescriptor < 0)
+        return false;
+
+    if(ftruncate(fileDescriptor,static_cast<off_t>(storageSize)) != 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    // Reserve both halves first,
+    // then map the same pages
+    // over each of them
+
+    char* reservedAddress = static_cast<char*>(mmap(nullptr,2 * storageSize,PROT_NONE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0));
+
+    if(reservedAddress == MAP_FAILED)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    void* firstHalf = mmap(reservedAddress,storageSize,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_FIXED,fileDescriptor,0);
+    void* secondHalf = mmap(reservedAddress + storageSize,storageSize,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_FIXED,fileDescriptor,0);
+
+    close(fileDescriptor);
+
+    if(firstHalf != reservedAddress || secondHalf != reservedAddress + storageSize)
+    {
+        munmap(reservedAddress,2 * storageSize);
+        return false;
+    }
+
+    m_data = reinterpret_cast<blDataType*>(reservedAddress);
+    m_capacity = storageSize / sizeof(blDataType);
+    m_isMirrored = true;
+
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::allocateFallbackStorage(const size_t& minimumCapacity)
+{
+    m_data = new blDataType[2 * minimumCapacity];
+    m_capacity = minimumCapacity;
+    m_isMirrored = false;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::releaseStorage()
+{
+    if(!m_data)
+        return;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+
+    if(m_isMirrored)
+    {
+        munmap(m_data,2 * m_capacity * sizeof(blDataType));
+        m_data = nullptr;
+        return;
+    }
+
+#endif
+
+    delete[] m_data;
+    m_data = nullptr;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::mirrorValues(const size_t& position,
+                                                                                const size_t& numberOfValues)
+{
+    if(m_isMirrored || numberOfValues == 0)
+        return;
+
+    // Values written to the first
+    // half are copied to the second
+    // one and vice versa, the written
+    // range is at most "capacity" long
+    // so it's at most two copies
+
+    size_t currentPosition = position;
+    size_t valuesLeft = numberOfValues;
+
+    while(valuesLeft > 0)
+    {
+        size_t halfPosition = (currentPosition < m_capacity ? currentPosition : currentPosition - m_capacity);
+        size_t valuesInThisHalf = std::min(valuesLeft,m_capacity - halfPosition);
+
+        if(currentPosition < m_capacity)
+            std::memcpy(static_cast<void*>(m_data + m_capacity + halfPosition),static_cast<const void*>(m_data + halfPosition),valuesInThisHalf * sizeof(blDataType));
+        else
+            std::memcpy(static_cast<void*>(m_data + halfPosition),static_cast<const void*>(m_data + m_capacity + halfPosition),valuesInThisHalf * sizeof(blDataType));
+
+        currentPosition += valuesInThisHalf;
+        valuesLeft -= valuesInThisHalf;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::writeValues(const size_t& position,
+                                                                               const blDataType* values,
+                                                                               const size_t& numberOfValues)
+{
+    std::memcpy(static_cast<void*>(m_data + position),static_cast<const void*>(values),numberOfValues * sizeof(blDataType));
+
+    mirrorValues(position,numberOfValues);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline size_t blMirroredRingBuffer<blDataType,blOverflowPolicyType>::push_back(const blDataType* values,
+                                                                               const size_t& numberOfValues)
+{
+    size_t numberOfValuesToPush = getNumberOfValuesToPush(numberOfValues,blOverflowPolicyType());
+
+    if(numberOfValuesToPush == 0 || m_capacity == 0)
+        return 0;
+
+    // When overwriting with more
+    // values than the buffer can
+    // hold, only the newest ones
+    // are kept
+
+    if(numberOfValuesToPush >= m_capacity)
+    {
+        writeValues(0,values + (numberOfValuesToPush - m_capacity),m_capacity);
+
+        m_head = 0;
+        m_size = m_capacity;
+
+        return numberOfValuesToPush;
+    }
+
+    // Thanks to the mirror, the
+    // free space after the tail
+    // is always contiguous
+
+    size_t tail = m_head + m_size;
+
+    if(tail >= m_capacity)
+        tail -= m_capacity;
+
+    writeValues(tail,values,numberOfValuesToPush);
+
+    m_size += numberOfValuesToPush;
+
+    if(m_size > m_capacity)
+    {
+        m_head += m_size - m_capacity;
+
+        if(m_head >= m_capacity)
+            m_head -= m_capacity;
+
+        m_size = m_capacity;
+    }
+
+    return numberOfValuesToPush;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::commitWrite(const size_t& numberOfValues)
+{
+    size_t numberOfValuesWritten = std::min(numberOfValues,m_capacity - m_size);
+
+    mirrorValues(m_head + m_size,numberOfValuesWritten);
+
+    m_size += numberOfValuesWritten;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline size_t blMirroredRingBuffer<blDataType,blOverflowPolicyType>::consume(const size_t& numberOfValues)
+{
+    size_t numberOfValuesToConsume = std::min(numberOfValues,m_size);
+
+    m_head += numberOfValuesToConsume;
+
+    if(m_head >= m_capacity)
+        m_head -= m_capacity;
+
+    m_size -= numberOfValuesToConsume;
+
+    return numberOfValuesToConsume;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline blRawArrayWrapper<blDataType> blMirroredRingBuffer<blDataType,blOverflowPolicyType>::getReadSpan(const size_t& offset,
+                                                                                                          const size_t& numberOfValues)
+{
+    if(offset >= m_size)
+        return blRawArrayWrapper<blDataType>();
+
+    return blRawArrayWrapper<blDataType>(m_data + m_head + offset,
+                                         std::min(numberOfValues,m_size - offset));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOverflowPolicyType>
+inline void blMirroredRingBuffer<blDataType,blOverflowPolicyType>::syncMirror()
+{
+    mirrorValues(m_head,m_size);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_MIRROREDRINGBUFFER_HPP
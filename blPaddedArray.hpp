@@ -0,0 +1,150 @@
+#ifndef BL_PADDEDARRAY_HPP
+#define BL_PADDEDARRAY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blPaddedArray.hpp
+// CLASS:           blCacheLinePadded
+//                  blPaddedArray
+// BASE CLASS:      None
+//
+// PURPOSE:         A static templated array whose elements
+//                  each sit on their own cache line.
+//
+//                  It is meant for per-thread data, like
+//                  counters or partial results, where every
+//                  thread writes to its own element and
+//                  sharing a cache line between elements
+//                  would make the threads fight over it
+//                  ("false sharing").
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawIterator
+//                  - blCacheLineSize (defined in blArray.hpp)
+//
+// NOTES:           - The array's iterators walk over the
+//                    padded slots, which convert implicitly
+//                    to a reference of the stored element
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// One element padded and aligned
+// to a whole cache line
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blLineSize = blCacheLineSize>
+
+struct alignas(blLineSize) blCacheLinePadded
+{
+    blCacheLinePadded() : m_value(){}
+    blCacheLinePadded(const blDataType& value) : m_value(value){}
+
+    blCacheLinePadded<blDataType,blLineSize>&               operator=(const blDataType& value){m_value = value;return (*this);}
+
+    operator                                                blDataType&(){return m_value;}
+    operator                                                const blDataType&()const{return m_value;}
+
+    blDataType                                              m_value;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blLineSize = blCacheLineSize>
+
+class blPaddedArray
+{
+public: // Public typedefs
+
+    typedef blCacheLinePadded<blDataType,blLineSize>        blPaddedType;
+
+    typedef blRawIterator<blPaddedType>                     iterator;
+    typedef blRawIterator<const blPaddedType>               const_iterator;
+
+    typedef blRawReverseIterator<blPaddedType>              reverse_iterator;
+    typedef blRawReverseIterator<const blPaddedType>        const_reverse_iterator;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    blPaddedArray() = default;
+
+    // Constructor setting
+    // every element to the
+    // specified value
+
+    blPaddedArray(const blDataType& value)
+    {
+        fill(value);
+    }
+
+    // Destructor
+
+    ~blPaddedArray()
+    {
+    }
+
+public: // Public functions
+
+    // Element access
+    // functions
+
+    blDataType&                                             operator[](const size_t elementIndex){return m_container[elementIndex].m_value;}
+    const blDataType&                                       operator[](const size_t elementIndex)const{return m_container[elementIndex].m_value;}
+
+    // Functions used
+    // to return the
+    // array size
+
+    size_t                                                  length()const{return blArraySize;}
+    size_t                                                  size()const{return blArraySize;}
+    size_t                                                  max_size()const{return blArraySize;}
+    bool                                                    empty()const{return (blArraySize == 0);}
+
+    // Function used to
+    // fill the array
+    // with a specified
+    // value
+
+    void                                                    fill(const blDataType& value)
+    {
+        for(size_t i = 0; i < blArraySize; ++i)
+            m_container[i].m_value = value;
+    }
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return &(m_container[0]);}
+    iterator                                                end(){return &(m_container[blArraySize]);}
+    const_iterator                                          cbegin()const{return &(m_container[0]);}
+    const_iterator                                          cend()const{return &(m_container[blArraySize]);}
+
+    reverse_iterator                                        rbegin(){return &(m_container[blArraySize - 1]);}
+    reverse_iterator                                        rend(){return &(m_container[-1]);}
+    const_reverse_iterator                                  crbegin()const{return &(m_container[blArraySize - 1]);}
+    const_reverse_iterator                                  crend()const{return &(m_container[-1]);}
+
+private: // Private data
+
+    // The padded
+    // elements
+
+    blPaddedType                                            m_container[blArraySize];
+};
+//-------------------------------------------------------------------
+
+
+#endif // BL_PADDEDARRAY_HPP
@@ -0,0 +1,629 @@
+#ifndef BL_PARALLELSCAN_HPP
+#define BL_PARALLELSCAN_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blParallelScan.hpp
+// CLASS:           blSseScan
+// BASE CLASS:      None
+//
+// PURPOSE:         Inclusive and exclusive prefix sums (scans)
+//                  with any associative operator, over raw arrays,
+//                  blRawArrayWrappers and blIterator ranges, split
+//                  among threads with the two pass blocked approach:
+//
+//                  - Every thread reduces its own chunk of the
+//                    input
+//
+//                  - The chunks' reductions are scanned, giving
+//                    every chunk the value carried into it
+//
+//                  - Every thread scans its own chunk starting
+//                    from its carried value
+//
+//                  Scans with std::plus over integers, floats and
+//                  doubles run their in-chunk loops with SSE2,
+//                  adding shifted copies of a vector to itself to
+//                  scan it and broadcasting its last lane as the
+//                  carry into the next one.
+//
+//                  blIterator ranges (linear, circular, over
+//                  contiguous or segmented containers) are walked
+//                  one contiguous piece at a time (see
+//                  blForEachSegment).
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper
+//                  - blSimdAlgorithms -- blForEachSegment
+//
+// NOTES:           - The operator has to be associative, it does
+//                    not have to be commutative
+//
+//                  - Floating point sums are added in a different
+//                    order than a sequential loop would, so they
+//                    can differ from it by rounding
+//
+//                  - The output can be the input (in place scans)
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Arrays smaller than this are
+// not worth splitting among
+// threads
+//-------------------------------------------------------------------
+const size_t                                                blParallelScanMinElementsPerThread = 64 * 1024;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The SSE2 scans of a vector
+//
+// NOTE:    Each specialization scans
+//          the lanes of one vector,
+//          shifts them up by one lane
+//          and broadcasts the last
+//          lane
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blSseScan
+{
+};
+
+#if defined(__SSE2__)
+
+#define BL_DEFINE_SSE_INTEGER_SCAN(blType,blAdd,blLaneBytes,blLastLaneShuffle)         \
+template<>                                                                              \
+struct blSseScan<blType>                                                                \
+{                                                                                       \
+    typedef __m128i                                         blVectorType;               \
+                                                                                        \
+    static const size_t                                     blNumberOfLanes = 16 / sizeof(blType);   \
+                                                                                        \
+    static blVectorType load(const blType* data){return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));}   \
+    static void store(blType* data,const blVectorType& values){_mm_storeu_si128(reinterpret_cast<__m128i*>(data),values);}   \
+    static blVectorType add(const blVectorType& a,const blVectorType& b){return blAdd(a,b);}   \
+    static blVectorType shiftUp(const blVectorType& values){return _mm_slli_si128(values,blLaneBytes);}   \
+    static blVectorType broadcastLast(const blVectorType& values){return _mm_shuffle_epi32(values,blLastLaneShuffle);}   \
+    static blVectorType broadcast(const blType& value){blType lanes[blNumberOfLanes];for(size_t i = 0; i < blNumberOfLanes; ++i) lanes[i] = value;return load(lanes);}   \
+    static blType getLast(const blVectorType& values){blType lanes[blNumberOfLanes];store(lanes,values);return lanes[blNumberOfLanes - 1];}   \
+                                                                                        \
+    static blVectorType scan(blVectorType values)                                       \
+    {                                                                                   \
+        values = blAdd(values,_mm_slli_si128(values,blLaneBytes));                      \
+        if(blLaneBytes < 8)                                                             \
+            values = blAdd(values,_mm_slli_si128(values,8));                            \
+        return values;                                                                  \
+    }                                                                                   \
+};
+
+BL_DEFINE_SSE_INTEGER_SCAN(int32_t,_mm_add_epi32,4,0xFF)
+BL_DEFINE_SSE_INTEGER_SCAN(uint32_t,_mm_add_epi32,4,0xFF)
+BL_DEFINE_SSE_INTEGER_SCAN(int64_t,_mm_add_epi64,8,0xEE)
+BL_DEFINE_SSE_INTEGER_SCAN(uint64_t,_mm_add_epi64,8,0xEE)
+
+#undef BL_DEFINE_SSE_INTEGER_SCAN
+
+template<>
+struct blSseScan<float>
+{
+    typedef __m128                                          blVectorType;
+
+    static const size_t                                     blNumberOfLanes = 4;
+
+    static blVectorType load(const float* data){return _mm_loadu_ps(data);}
+    static void store(float* data,const blVectorType& values){_mm_storeu_ps(data,values);}
+    static blVectorType add(const blVectorType& a,const blVectorType& b){return _mm_add_ps(a,b);}
+    static blVectorType shiftUp(const blVectorType& values){return _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(values),4));}
+    static blVectorType broadcastLast(const blVectorType& values){return _mm_shuffle_ps(values,values,0xFF);}
+    static blVectorType broadcast(const float& value){return _mm_set1_ps(value);}
+    static float getLast(const blVectorType& values){return _mm_cvtss_f32(broadcastLast(values));}
+
+    static blVectorType scan(blVectorType values)
+    {
+        values = _mm_add_ps(values,shiftUp(values));
+        values = _mm_add_ps(values,_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(values),8)));
+        return values;
+    }
+};
+
+template<>
+struct blSseScan<double>
+{
+    typedef __m128d                                         blVectorType;
+
+    static const size_t                                     blNumberOfLanes = 2;
+
+    static blVectorType load(const double* data){return _mm_loadu_pd(data);}
+    static void store(double* data,const blVectorType& values){_mm_storeu_pd(data,values);}
+    static blVectorType add(const blVectorType& a,const blVectorType& b){return _mm_add_pd(a,b);}
+    static blVectorType shiftUp(const blVectorType& values){return _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(values),8));}
+    static blVectorType broadcastLast(const blVectorType& values){return _mm_unpackhi_pd(values,values);}
+    static blVectorType broadcast(const double& value){return _mm_set1_pd(value);}
+    static double getLast(const blVectorType& values){return _mm_cvtsd_f64(broadcastLast(values));}
+
+    static blVectorType scan(const blVectorType& values)
+    {
+        return _mm_add_pd(values,shiftUp(values));
+    }
+};
+
+#endif // __SSE2__
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Trait used to know whether a
+// scan can use the SSE2 kernels
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperatorType>
+struct blIsSseScan : std::false_type
+{
+};
+
+#if defined(__SSE2__)
+
+template<> struct blIsSseScan< int32_t,std::plus<int32_t> > : std::true_type{};
+template<> struct blIsSseScan< uint32_t,std::plus<uint32_t> > : std::true_type{};
+template<> struct blIsSseScan< int64_t,std::plus<int64_t> > : std::true_type{};
+template<> struct blIsSseScan< uint64_t,std::plus<uint64_t> > : std::true_type{};
+template<> struct blIsSseScan< float,std::plus<float> > : std::true_type{};
+template<> struct blIsSseScan< double,std::plus<double> > : std::true_type{};
+
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The in-chunk kernels, scanning or
+// reducing "n" elements starting
+// from a carried value, and returning
+// the value carried out of them
+//
+// NOTE:    The kernels read each element
+//          before writing its output, so
+//          the output can be the input
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperatorType>
+inline blDataType blInclusiveScanSegment(const blDataType* input,
+                                         const size_t& n,
+                                         blDataType* output,
+                                         blDataType carry,
+                                         const blOperatorType& op,
+                                         std::false_type)
+{
+    for(size_t i = 0; i < n; ++i)
+    {
+        carry = op(carry,input[i]);
+        output[i] = carry;
+    }
+
+    return carry;
+}
+
+template<typename blDataType,typename blOperatorType>
+inline blDataType blExclusiveScanSegment(const blDataType* input,
+                                         const size_t& n,
+                                         blDataType* output,
+                                         blDataType carry,
+                                         const blOperatorType& op,
+                                         std::false_type)
+{
+    for(size_t i = 0; i < n; ++i)
+    {
+        blDataType value = input[i];
+
+        output[i] = carry;
+        carry = op(carry,value);
+    }
+
+    return carry;
+}
+
+template<typename blDataType,typename blOperatorType>
+inline blDataType blReduceSegment(const blDataType* input,
+                                  const size_t& n,
+                                  blDataType carry,
+                                  const blOperatorType& op,
+                                  std::false_type)
+{
+    for(size_t i = 0; i < n; ++i)
+        carry = op(carry,input[i]);
+
+    return carry;
+}
+
+#if defined(__SSE2__)
+
+template<typename blDataType,typename blOperatorType>
+inline blDataType blInclusiveScanSegment(const blDataType* input,
+                                         const size_t& n,
+                                         blDataType* output,
+                                         blDataType carry,
+                                         const blOperatorType& op,
+                                         std::true_type)
+{
+    typedef blSseScan<blDataType>                           blScan;
+
+    const size_t numberOfLanes = blScan::blNumberOfLanes;
+
+    size_t i = 0;
+
+    if(n >= numberOfLanes)
+    {
+        auto carries = blScan::broadcast(carry);
+
+        for(; i + numberOfLanes <= n; i += numberOfLanes)
+        {
+            auto values = blScan::add(blScan::scan(blScan::load(input + i)),carries);
+
+            blScan::store(output + i,values);
+
+            carries = blScan::broadcastLast(values);
+        }
+
+        carry = blScan::getLast(carries);
+    }
+
+    return blInclusiveScanSegment(input + i,n - i,output + i,carry,op,std::false_type());
+}
+
+template<typename blDataType,typename blOperatorType>
+inline blDataType blExclusiveScanSegment(const blDataType* input,
+                                         const size_t& n,
+                                         blDataType* output,
+                                         blDataType carry,
+                                         const blOperatorType& op,
+                                         std::true_type)
+{
+    typedef blSseScan<blDataType>                           blScan;
+
+    const size_t numberOfLanes = blScan::blNumberOfLanes;
+
+    size_t i = 0;
+
+    if(n >= numberOfLanes)
+    {
+        auto carries = blScan::broadcast(carry);
+
+        for(; i + numberOfLanes <= n; i += numberOfLanes)
+        {
+            auto values = blScan::scan(blScan::load(input + i));
+
+            blScan::store(output + i,blScan::add(blScan::shiftUp(values),carries));
+
+            carries = blScan::broadcastLast(blScan::add(values,carries));
+        }
+
+        carry = blScan::getLast(carries);
+    }
+
+    return blExclusiveScanSegment(input + i,n - i,output + i,carry,op,std::false_type());
+}
+
+template<typename blDataType,typename blOperatorType>
+inline blDataType blReduceSegment(const blDataType* input,
+                                  const size_t& n,
+                                  blDataType carry,
+                                  const blOperatorType& op,
+                                  std::true_type)
+{
+    typedef blSseScan<blDataType>                           blScan;
+
+    const size_t numberOfLanes = blScan::blNumberOfLanes;
+
+    size_t i = 0;
+
+    if(n >= numberOfLanes)
+    {
+        auto sums = blScan::load(input);
+
+        for(i = numberOfLanes; i + numberOfLanes <= n; i += numberOfLanes)
+            sums = blScan::add(sums,blScan::load(input + i));
+
+        carry = op(carry,blScan::getLast(blScan::scan(sums)));
+    }
+
+    return blReduceSegment(input + i,n - i,carry,op,std::false_type());
+}
+
+#endif // __SSE2__
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The blocked scan, walking its
+// input through a function which
+// calls functor(begin,end,offset)
+// for each contiguous piece of the
+// "n" elements starting at a given
+// index
+//
+// NOTE:    Without a carried value
+//          (inclusive scans) the first
+//          element starts the scan
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperatorType,typename blInputWalkerType>
+inline void blBlockedScan(const size_t& numberOfElements,
+                          blDataType* output,
+                          const bool& isInclusive,
+                          const blDataType& initialValue,
+                          const blOperatorType& op,
+                          const size_t& numberOfThreads,
+                          const blInputWalkerType& walkInput)
+{
+    typedef blIsSseScan<blDataType,blOperatorType>          blIsSseScanType;
+
+    if(numberOfElements == 0)
+        return;
+
+    size_t numberOfUsedThreads = std::max(size_t(1),std::min(numberOfThreads,numberOfElements / blParallelScanMinElementsPerThread));
+    size_t numberOfElementsPerThread = numberOfElements / numberOfUsedThreads;
+
+    auto getChunkBegin = [=](const size_t& chunk){return chunk * numberOfElementsPerThread;};
+    auto getChunkSize = [=](const size_t& chunk){return (chunk == numberOfUsedThreads - 1 ? numberOfElements - chunk * numberOfElementsPerThread : numberOfElementsPerThread);};
+
+    // Function used to scan a chunk
+    // from its carried value
+
+    auto scanChunk = [&](const size_t& chunk,blDataType carry,bool hasCarry)
+    {
+        size_t chunkBegin = getChunkBegin(chunk);
+
+        walkInput(chunkBegin,getChunkSize(chunk),[&](const blDataType* begin,const blDataType* end,const ptrdiff_t& offset)
+        {
+            blDataType* pieceOutput = output + chunkBegin + offset;
+
+            if(!hasCarry)
+            {
+                carry = (*begin);
+                (*pieceOutput) = carry;
+
+                ++begin;
+                ++pieceOutput;
+
+                hasCarry = true;
+            }
+
+            if(isInclusive)
+                carry = blInclusiveScanSegment(begin,size_t(end - begin),pieceOutput,carry,op,blIsSseScanType());
+            else
+                carry = blExclusiveScanSegment(begin,size_t(end - begin),pieceOutput,carry,op,blIsSseScanType());
+
+            return true;
+        });
+    };
+
+    if(numberOfUsedThreads == 1)
+    {
+        scanChunk(0,initialValue,!isInclusive);
+        return;
+    }
+
+    // First pass, reducing
+    // every chunk but the
+    // last one
+
+    std::vector<blDataType> reductions(numberOfUsedThreads,initialValue);
+    std::vector<unsigned char> hasReductions(numberOfUsedThreads,0);
+
+    auto reduceChunk = [&](const size_t& chunk)
+    {
+        walkInput(getChunkBegin(chunk),getChunkSize(chunk),[&](const blDataType* begin,const blDataType* end,const ptrdiff_t&)
+        {
+            if(!hasReductions[chunk])
+            {
+                reductions[chunk] = (*begin);
+                hasReductions[chunk] = 1;
+                ++begin;
+            }
+
+            reductions[chunk] = blReduceSegment(begin,size_t(end - begin),reductions[chunk],op,blIsSseScanType());
+
+            return true;
+        });
+    };
+
+    std::vector<std::thread> threads;
+
+    for(size_t chunk = 1; chunk < numberOfUsedThreads - 1; ++chunk)
+        threads.emplace_back(reduceChunk,chunk);
+
+    reduceChunk(0);
+
+    for(auto& thread : threads)
+        thread.join();
+
+    threads.clear();
+
+    // The values carried into
+    // each chunk
+
+    std::vector<blDataType> carries(numberOfUsedThreads,initialValue);
+
+    carries[1] = (isInclusive ? reductions[0] : op(initialValue,reductions[0]));
+
+    for(size_t chunk = 2; chunk < numberOfUsedThreads; ++chunk)
+        carries[chunk] = op(carries[chunk - 1],reductions[chunk - 1]);
+
+    // Second pass, scanning
+    // every chunk
+
+    for(size_t chunk = 1; chunk < numberOfUsedThreads; ++chunk)
+        threads.emplace_back(scanChunk,chunk,carries[chunk],true);
+
+    scanChunk(0,initialValue,!isInclusive);
+
+    for(auto& thread : threads)
+        thread.join();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The scans of raw arrays
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperatorType = std::plus<blDataType> >
+inline void blInclusiveScan(const blDataType* input,
+                            const size_t& numberOfElements,
+                            blDataType* output,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    blBlockedScan(numberOfElements,
+                  output,
+                  true,
+                  blDataType(),
+                  op,
+                  numberOfThreads,
+                  [input](const size_t& begin,const size_t& n,const std::function<bool(const blDataType*,const blDataType*,const ptrdiff_t&)>& functor)
+                  {
+                      functor(input + begin,input + begin + n,0);
+                  });
+}
+
+template<typename blDataType,typename blOperatorType = std::plus<blDataType> >
+inline void blExclusiveScan(const blDataType* input,
+                            const size_t& numberOfElements,
+                            blDataType* output,
+                            const blDataType& initialValue,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    blBlockedScan(numberOfElements,
+                  output,
+                  false,
+                  initialValue,
+                  op,
+                  numberOfThreads,
+                  [input](const size_t& begin,const size_t& n,const std::function<bool(const blDataType*,const blDataType*,const ptrdiff_t&)>& functor)
+                  {
+                      functor(input + begin,input + begin + n,0);
+                  });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The in place scans of
+// blRawArrayWrappers
+//-------------------------------------------------------------------
+template<typename blDataType,typename blOperatorType = std::plus<blDataType> >
+inline void blInclusiveScan(blRawArrayWrapper<blDataType> data,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    blInclusiveScan(data.begin().getPtr(),data.size(),data.begin().getPtr(),op,numberOfThreads);
+}
+
+template<typename blDataType,typename blOperatorType = std::plus<blDataType> >
+inline void blExclusiveScan(blRawArrayWrapper<blDataType> data,
+                            const blDataType& initialValue,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    blExclusiveScan(data.begin().getPtr(),data.size(),data.begin().getPtr(),initialValue,op,numberOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The scans of the "n" elements of
+// blIterator ranges starting at
+// "first" into raw arrays
+//
+// NOTE:    Circular iterators can
+//          scan more than one lap
+//          of their buffer
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,
+         typename blOperatorType = std::plus<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+inline void blInclusiveScan(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                            const size_t& numberOfElements,
+                            typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType* output,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    typedef typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType   blDataType;
+
+    blBlockedScan(numberOfElements,
+                  output,
+                  true,
+                  blDataType(),
+                  op,
+                  numberOfThreads,
+                  [&first](const size_t& begin,const size_t& n,const std::function<bool(const blDataType*,const blDataType*,const ptrdiff_t&)>& functor)
+                  {
+                      blForEachSegment(first + ptrdiff_t(begin),ptrdiff_t(n),functor);
+                  });
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,
+         typename blOperatorType = std::plus<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+inline void blExclusiveScan(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                            const size_t& numberOfElements,
+                            typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType* output,
+                            const typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType& initialValue,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    typedef typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType   blDataType;
+
+    blBlockedScan(numberOfElements,
+                  output,
+                  false,
+                  initialValue,
+                  op,
+                  numberOfThreads,
+                  [&first](const size_t& begin,const size_t& n,const std::function<bool(const blDataType*,const blDataType*,const ptrdiff_t&)>& functor)
+                  {
+                      blForEachSegment(first + ptrdiff_t(begin),ptrdiff_t(n),functor);
+                  });
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The scans of blIterator ranges
+// into raw arrays
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,
+         typename blOperatorType = std::plus<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+inline void blInclusiveScan(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                            const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                            typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType* output,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    ptrdiff_t numberOfElements = last - first;
+
+    blInclusiveScan(first,numberOfElements > 0 ? size_t(numberOfElements) : size_t(0),output,op,numberOfThreads);
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,
+         typename blOperatorType = std::plus<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType> >
+inline void blExclusiveScan(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                            const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                            typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType* output,
+                            const typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType& initialValue,
+                            const blOperatorType& op = blOperatorType(),
+                            const size_t& numberOfThreads = 1)
+{
+    ptrdiff_t numberOfElements = last - first;
+
+    blExclusiveScan(first,numberOfElements > 0 ? size_t(numberOfElements) : size_t(0),output,initialValue,op,numberOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_PARALLELSCAN_HPP
@@ -0,0 +1,343 @@
+#ifndef BL_RADIXSORT_HPP
+#define BL_RADIXSORT_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blRadixSort.hpp
+// CLASS:           blRadixKey
+//                  blRadixIdentityKey
+// BASE CLASS:      None
+//
+// PURPOSE:         Least significant digit radix sort of raw arrays,
+//                  blArrays and blRawArrayWrappers whose elements
+//                  are (or contain) integer or floating point keys.
+//
+//                  The sort is stable and takes 8-bit digits, so a
+//                  32-bit key takes at most 4 passes over the data,
+//                  which beats std::sort's O(n log n) comparisons
+//                  on big arrays:
+//
+//                  - One read pass builds the histograms of every
+//                    digit at once (optionally split among threads)
+//
+//                  - Digits that are the same for every element
+//                    are skipped
+//
+//                  - Every other digit takes one scatter pass,
+//                    ping-ponging between the data and a scratch
+//                    buffer
+//
+//                  Elements which are not keys themselves (a key
+//                  with a payload for example) are sorted through
+//                  a key extractor returning their key.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blArray
+//                  - blRawArrayWrapper
+//                  - blArena -- Used to get the scratch buffer
+//                               when the caller doesn't give one
+//
+// NOTES:           - The scratch buffer has to hold as many
+//                    elements as the data
+//
+//                  - Elements are moved with plain copies, so
+//                    they have to be trivially copyable
+//
+//                  - Signed integers get their sign bit flipped
+//                    and floats get all their bits flipped when
+//                    negative (only their sign bit otherwise),
+//                    so the keys sort as unsigned integers
+//                    (NaNs end up at either end)
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Arrays smaller than this are
+// not worth splitting among
+// threads when counting digits
+//-------------------------------------------------------------------
+const size_t                                                blRadixSortMinElementsPerThread = 64 * 1024;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Traits mapping a key into an unsigned
+// integer sorting in the same order
+//-------------------------------------------------------------------
+template<typename blKeyType,typename blEnableType = void>
+struct blRadixKey
+{
+    static_assert(sizeof(blKeyType) == 0,"blRadixSort keys have to be integers, floats or doubles");
+};
+
+// Integers
+
+template<typename blKeyType>
+struct blRadixKey<blKeyType,
+                  typename std::enable_if<std::is_integral<blKeyType>::value &&
+                                          !std::is_same<blKeyType,bool>::value>::type>
+{
+    typedef typename std::make_unsigned<blKeyType>::type    blUnsignedKeyType;
+
+    static blUnsignedKeyType                                toUnsigned(const blKeyType& key)
+    {
+        return static_cast<blUnsignedKeyType>(key) ^ (std::is_signed<blKeyType>::value ? getSignBit() : blUnsignedKeyType(0));
+    }
+
+    static blUnsignedKeyType                                getSignBit()
+    {
+        return static_cast<blUnsignedKeyType>(blUnsignedKeyType(1) << (8 * sizeof(blKeyType) - 1));
+    }
+};
+
+// Floats and doubles
+
+template<typename blKeyType>
+struct blRadixKey<blKeyType,
+                  typename std::enable_if<std::is_floating_point<blKeyType>::value &&
+                                          (sizeof(blKeyType) == 4 || sizeof(blKeyType) == 8)>::type>
+{
+    typedef typename std::conditional<sizeof(blKeyType) == 4,
+                                      uint32_t,
+                                      uint64_t>::type       blUnsignedKeyType;
+
+    static blUnsignedKeyType                                toUnsigned(const blKeyType& key)
+    {
+        blUnsignedKeyType bits;
+        std::memcpy(&bits,&key,sizeof(bits));
+
+        // Negative keys get all their
+        // bits flipped, positive keys
+        // only their sign bit
+
+        blUnsignedKeyType signBit = blUnsignedKeyType(1) << (8 * sizeof(bits) - 1);
+
+        return bits ^ (blUnsignedKeyType(0 - (bits >> (8 * sizeof(bits) - 1))) | signBit);
+    }
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The default key extractor, used
+// when the elements are the keys
+//-------------------------------------------------------------------
+struct blRadixIdentityKey
+{
+    template<typename blDataType>
+    const blDataType&                                       operator()(const blDataType& value)const{return value;}
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to count the digits
+// of the keys of a range of elements,
+// for every digit position at once
+//
+// NOTE:    "counts" holds 256 counts
+//          per digit position and has
+//          to start zeroed
+//-------------------------------------------------------------------
+template<typename blRadixKeyType,typename blDataType,typename blKeyExtractorType>
+inline void blRadixSortCountDigits(const blDataType* data,
+                                   const size_t& numberOfElements,
+                                   const blKeyExtractorType& keyExtractor,
+                                   size_t* counts)
+{
+    const size_t numberOfDigits = sizeof(typename blRadixKeyType::blUnsignedKeyType);
+
+    for(size_t i = 0; i < numberOfElements; ++i)
+    {
+        auto key = blRadixKeyType::toUnsigned(keyExtractor(data[i]));
+
+        for(size_t digit = 0; digit < numberOfDigits; ++digit)
+            ++counts[digit * 256 + ((key >> (8 * digit)) & 0xFF)];
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The radix sort of a raw array
+//
+// NOTE:    When "numberOfThreads" is more
+//          than one, the digits are counted
+//          by that many threads, each one
+//          counting a slice of the data
+//-------------------------------------------------------------------
+template<typename blDataType,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blDataType* data,
+                        const size_t& numberOfElements,
+                        blDataType* scratch,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    static_assert(std::is_trivially_copyable<blDataType>::value,
+                  "blRadixSort needs trivially copyable elements");
+
+    typedef typename std::decay<decltype(keyExtractor(*data))>::type  blKeyType;
+    typedef blRadixKey<blKeyType>                                       blRadixKeyType;
+
+    const size_t numberOfDigits = sizeof(typename blRadixKeyType::blUnsignedKeyType);
+
+    if(numberOfElements < 2)
+        return;
+
+    // Count the digits
+
+    std::vector<size_t> counts(numberOfDigits * 256,0);
+
+    size_t numberOfUsedThreads = std::min(numberOfThreads,numberOfElements / blRadixSortMinElementsPerThread);
+
+    if(numberOfUsedThreads > 1)
+    {
+        std::vector<size_t> threadCounts(numberOfUsedThreads * numberOfDigits * 256,0);
+        std::vector<std::thread> threads;
+
+        size_t numberOfElementsPerThread = numberOfElements / numberOfUsedThreads;
+
+        for(size_t i = 0; i < numberOfUsedThreads; ++i)
+        {
+            size_t begin = i * numberOfElementsPerThread;
+            size_t end = (i == numberOfUsedThreads - 1) ? numberOfElements : begin + numberOfElementsPerThread;
+
+            threads.emplace_back([=,&keyExtractor,&threadCounts]()
+            {
+                blRadixSortCountDigits<blRadixKeyType>(data + begin,
+                                                       end - begin,
+                                                       keyExtractor,
+                                                       &threadCounts[i * numberOfDigits * 256]);
+            });
+        }
+
+        for(auto& thread : threads)
+            thread.join();
+
+        for(size_t i = 0; i < numberOfUsedThreads; ++i)
+        {
+            for(size_t j = 0; j < numberOfDigits * 256; ++j)
+                counts[j] += threadCounts[i * numberOfDigits * 256 + j];
+        }
+    }
+    else
+    {
+        blRadixSortCountDigits<blRadixKeyType>(data,numberOfElements,keyExtractor,&counts[0]);
+    }
+
+    // Scatter the elements once
+    // per digit, skipping the
+    // digits that are the same
+    // for every element
+
+    blDataType* source = data;
+    blDataType* destination = scratch;
+
+    for(size_t digit = 0; digit < numberOfDigits; ++digit)
+    {
+        size_t* digitCounts = &counts[digit * 256];
+
+        size_t shift = 8 * digit;
+
+        if(digitCounts[(blRadixKeyType::toUnsigned(keyExtractor(source[0])) >> shift) & 0xFF] == numberOfElements)
+            continue;
+
+        size_t offsets[256];
+        size_t offset = 0;
+
+        for(size_t i = 0; i < 256; ++i)
+        {
+            offsets[i] = offset;
+            offset += digitCounts[i];
+        }
+
+        for(size_t i = 0; i < numberOfElements; ++i)
+            destination[offsets[(blRadixKeyType::toUnsigned(keyExtractor(source[i])) >> shift) & 0xFF]++] = source[i];
+
+        std::swap(source,destination);
+    }
+
+    if(source != data)
+        std::memcpy(data,source,numberOfElements * sizeof(blDataType));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The radix sort of a raw array using
+// a scratch buffer taken from an arena
+//-------------------------------------------------------------------
+template<typename blDataType,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blDataType* data,
+                        const size_t& numberOfElements,
+                        blArena& arena,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    blDataType* scratch = static_cast<blDataType*>(arena.allocate(numberOfElements * sizeof(blDataType),
+                                                                  alignof(blDataType)));
+
+    blRadixSort(data,numberOfElements,scratch,keyExtractor,numberOfThreads);
+
+    arena.deallocate(scratch,numberOfElements * sizeof(blDataType));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The radix sort of blArrays
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blArray<blDataType,blArraySize,blAlignment>& array,
+                        blDataType* scratch,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    blRadixSort(array.data(),blArraySize,scratch,keyExtractor,numberOfThreads);
+}
+
+template<typename blDataType,size_t blArraySize,size_t blAlignment,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blArray<blDataType,blArraySize,blAlignment>& array,
+                        blArena& arena,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    blRadixSort(array.data(),blArraySize,arena,keyExtractor,numberOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The radix sort of blRawArrayWrappers
+//-------------------------------------------------------------------
+template<typename blDataType,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blRawArrayWrapper<blDataType>& array,
+                        blDataType* scratch,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    blRadixSort(array.begin().getPtr(),array.size(),scratch,keyExtractor,numberOfThreads);
+}
+
+template<typename blDataType,typename blKeyExtractorType = blRadixIdentityKey>
+inline void blRadixSort(blRawArrayWrapper<blDataType>& array,
+                        blArena& arena,
+                        blKeyExtractorType keyExtractor = blKeyExtractorType(),
+                        const size_t& numberOfThreads = 1)
+{
+    blRadixSort(array.begin().getPtr(),array.size(),arena,keyExtractor,numberOfThreads);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_RADIXSORT_HPP
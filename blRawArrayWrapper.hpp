@@ -75,6 +75,27 @@ public: // Constructors and destructors
     {
     }
 
+public: // Assignment operators
+
+    blRawArrayWrapper<blDataType>&                          operator=(const blRawArrayWrapper<blDataType>& rawArrayWrapper) = default;
+
+    // Operator used to evaluate
+    // an expression into the
+    // wrapped array (see
+    // blExpression.hpp)
+    //
+    // NOTE:    Only the elements
+    //          covered by both the
+    //          array and the expression
+    //          are written
+
+    template<typename blExpressionType>
+    blRawArrayWrapper<blDataType>&                          operator=(const blExpression<blExpressionType>& expression)
+    {
+        blEvaluateExpression(m_containerIter.getPtr(),m_size,expression);
+        return (*this);
+    }
+
 public: // Public functions
 
     // Additional operator
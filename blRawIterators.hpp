@@ -18,10 +18,18 @@ public:
     blRawIterator(const blRawIterator<blDataType>& rawIterator) = default;
     ~blRawIterator(){}
 
+    // Conversion from an iterator
+    // to non-const data into an
+    // iterator to const data
+
+    template<typename blOtherDataType,
+             typename = typename std::enable_if<std::is_convertible<blOtherDataType*,blDataType*>::value>::type>
+    blRawIterator(const blRawIterator<blOtherDataType>& rawIterator){m_ptr = rawIterator.getPtr();}
+
     blRawIterator<blDataType>&                  operator=(const blRawIterator<blDataType>& rawIterator) = default;
     blRawIterator<blDataType>&                  operator=(blDataType* ptr){m_ptr = ptr;return (*this);}
 
-    operator                                    bool()const
+    explicit operator                           bool()const
     {
         if(m_ptr)
             return true;
@@ -38,14 +46,15 @@ public:
     blRawIterator<blDataType>&                  operator--(){--m_ptr;return (*this);}
     blRawIterator<blDataType>                   operator++(int){auto temp(*this);++m_ptr;return temp;}
     blRawIterator<blDataType>                   operator--(int){auto temp(*this);--m_ptr;return temp;}
-    blRawIterator<blDataType>                   operator+(const ptrdiff_t& movement){auto oldPtr = m_ptr;m_ptr+=movement;auto temp(*this);m_ptr = oldPtr;return temp;}
-    blRawIterator<blDataType>                   operator-(const ptrdiff_t& movement){auto oldPtr = m_ptr;m_ptr-=movement;auto temp(*this);m_ptr = oldPtr;return temp;}
+    blRawIterator<blDataType>                   operator+(const ptrdiff_t& movement)const{return blRawIterator<blDataType>(m_ptr + movement);}
+    blRawIterator<blDataType>                   operator-(const ptrdiff_t& movement)const{return blRawIterator<blDataType>(m_ptr - movement);}
 
-    ptrdiff_t                                   operator-(const blRawIterator<blDataType>& rawIterator){return std::distance(rawIterator.getPtr(),this->getPtr());}
+    ptrdiff_t                                   operator-(const blRawIterator<blDataType>& rawIterator)const{return std::distance(rawIterator.getPtr(),this->getPtr());}
 
     blDataType&                                 operator*(){return *m_ptr;}
     const blDataType&                           operator*()const{return *m_ptr;}
     blDataType*                                 operator->(){return m_ptr;}
+    blDataType&                                 operator[](const ptrdiff_t& index)const{return m_ptr[index];}
 
     blDataType*                                 getPtr()const{return m_ptr;}
     const blDataType*                           getConstPtr()const{return m_ptr;}
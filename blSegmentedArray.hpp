@@ -0,0 +1,502 @@
+#ifndef BL_SEGMENTEDARRAY_HPP
+#define BL_SEGMENTEDARRAY_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSegmentedArray.hpp
+// CLASS:           blSegmentedArrayIterator
+//                  blSegmentedArray
+// BASE CLASS:      None
+//
+// PURPOSE:         An append only friendly container made of
+//                  fixed size blocks (like a std::deque growing
+//                  only at the back):
+//
+//                  - Growing allocates a new block and never
+//                    moves (nor reallocates) the elements already
+//                    stored, so their addresses are stable
+//
+//                  - Random access is O(1), through a table of
+//                    pointers to the blocks (the block size is a
+//                    power of two, so finding an element's block
+//                    is a shift and a mask)
+//
+//                  - Its iterators are segmented iterators, they
+//                    tell where their block ends, so blIterator's
+//                    next_n and the library's algorithms run
+//                    their inner loops over whole blocks instead
+//                    of going through the block table for every
+//                    element
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blRawArrayWrapper -- The blocks
+//                  - blIteratorTraits -- blIsSegmentedIterator
+//
+// NOTES:           - Pushing elements keeps pointers and references
+//                    to the other elements valid, but (like for a
+//                    std::deque) not iterators, since the block
+//                    table itself can grow
+//
+//                  - Blocks are only given back by the destructor,
+//                    "clear" and "shrink_to_fit"
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Default number of
+// elements per block
+//-------------------------------------------------------------------
+const size_t                                                blSegmentedArrayBlockSize = 1024;
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Random access iterator of a segmented
+// array, keeping a pointer to its element
+// and to the end of the element's block
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+
+class blSegmentedArrayIterator : public std::iterator<std::random_access_iterator_tag,
+                                                      typename std::remove_const<blDataType>::type,
+                                                      ptrdiff_t,
+                                                      blDataType*,
+                                                      blDataType&>
+{
+public:
+
+    typedef std::vector<typename std::remove_const<blDataType>::type*>     blBlockTableType;
+
+    blSegmentedArrayIterator() : m_blocks(nullptr),m_index(0),m_ptr(nullptr),m_blockEnd(nullptr)
+    {
+    }
+
+    blSegmentedArrayIterator(const blBlockTableType* blocks,
+                             const size_t& index)
+                             : m_blocks(blocks),
+                               m_index(index)
+    {
+        this->locate();
+    }
+
+    blSegmentedArrayIterator(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator) = default;
+    ~blSegmentedArrayIterator(){}
+
+    // Conversion from an iterator
+    // to non-const data into an
+    // iterator to const data
+
+    template<typename blOtherDataType,
+             typename = typename std::enable_if<std::is_convertible<blOtherDataType*,blDataType*>::value>::type>
+    blSegmentedArrayIterator(const blSegmentedArrayIterator<blOtherDataType,blBlockSize>& iterator)
+                             : m_blocks(iterator.getBlockTable()),
+                               m_index(iterator.getIndex()),
+                               m_ptr(iterator.getPtr()),
+                               m_blockEnd(iterator.getBlockEnd())
+    {
+    }
+
+    blSegmentedArrayIterator<blDataType,blBlockSize>&       operator=(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator) = default;
+
+    bool                                                    operator==(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index == iterator.getIndex());}
+    bool                                                    operator!=(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index != iterator.getIndex());}
+    bool                                                    operator<(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index < iterator.getIndex());}
+    bool                                                    operator>(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index > iterator.getIndex());}
+    bool                                                    operator<=(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index <= iterator.getIndex());}
+    bool                                                    operator>=(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return (m_index >= iterator.getIndex());}
+
+    // Steps only go through the
+    // block table when they cross
+    // a block's boundary
+
+    blSegmentedArrayIterator<blDataType,blBlockSize>&       operator++()
+    {
+        ++m_index;
+
+        if(m_ptr == nullptr || ++m_ptr == m_blockEnd)
+            this->locate();
+
+        return (*this);
+    }
+
+    blSegmentedArrayIterator<blDataType,blBlockSize>&       operator--()
+    {
+        --m_index;
+
+        if(m_ptr == nullptr || m_ptr == m_blockEnd - blBlockSize)
+            this->locate();
+        else
+            --m_ptr;
+
+        return (*this);
+    }
+
+    blSegmentedArrayIterator<blDataType,blBlockSize>        operator++(int){auto temp(*this);++(*this);return temp;}
+    blSegmentedArrayIterator<blDataType,blBlockSize>        operator--(int){auto temp(*this);--(*this);return temp;}
+
+    blSegmentedArrayIterator<blDataType,blBlockSize>&       operator+=(const ptrdiff_t& movement){m_index += movement;this->locate();return (*this);}
+    blSegmentedArrayIterator<blDataType,blBlockSize>&       operator-=(const ptrdiff_t& movement){m_index -= movement;this->locate();return (*this);}
+    blSegmentedArrayIterator<blDataType,blBlockSize>        operator+(const ptrdiff_t& movement)const{auto temp(*this);temp += movement;return temp;}
+    blSegmentedArrayIterator<blDataType,blBlockSize>        operator-(const ptrdiff_t& movement)const{auto temp(*this);temp -= movement;return temp;}
+
+    ptrdiff_t                                               operator-(const blSegmentedArrayIterator<blDataType,blBlockSize>& iterator)const{return static_cast<ptrdiff_t>(m_index) - static_cast<ptrdiff_t>(iterator.getIndex());}
+
+    blDataType&                                             operator*()const{return (*m_ptr);}
+    blDataType*                                             operator->()const{return m_ptr;}
+    blDataType&                                             operator[](const ptrdiff_t& offset)const{return *((*this) + offset);}
+
+    const blBlockTableType*                                 getBlockTable()const{return m_blocks;}
+    size_t                                                  getIndex()const{return m_index;}
+    blDataType*                                             getPtr()const{return m_ptr;}
+    blDataType*                                             getBlockEnd()const{return m_blockEnd;}
+
+private:
+
+    // Function used to find the
+    // element's block (iterators
+    // past the last block get
+    // null pointers)
+
+    void                                                    locate()
+    {
+        size_t block = m_index / blBlockSize;
+
+        if(m_blocks && block < m_blocks->size())
+        {
+            m_ptr = (*m_blocks)[block] + m_index % blBlockSize;
+            m_blockEnd = (*m_blocks)[block] + blBlockSize;
+        }
+        else
+        {
+            m_ptr = nullptr;
+            m_blockEnd = nullptr;
+        }
+    }
+
+    const blBlockTableType*                                 m_blocks;
+    size_t                                                  m_index;
+    blDataType*                                             m_ptr;
+    blDataType*                                             m_blockEnd;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The segmented array's iterators
+// are segmented iterators
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize>
+struct blIsSegmentedIterator< blSegmentedArrayIterator<blDataType,blBlockSize> > : std::true_type
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The segmented array
+//-------------------------------------------------------------------
+template<typename blDataType,
+         size_t blBlockSize = blSegmentedArrayBlockSize,
+         typename blAllocatorType = std::allocator<blDataType> >
+
+class blSegmentedArray
+{
+    static_assert(blBlockSize > 0 && (blBlockSize & (blBlockSize - 1)) == 0,
+                  "blSegmentedArray block sizes have to be powers of two");
+
+public: // Public typedefs
+
+    typedef blDataType                                              value_type;
+    typedef blAllocatorType                                         allocator_type;
+
+    typedef blSegmentedArrayIterator<blDataType,blBlockSize>        iterator;
+    typedef blSegmentedArrayIterator<const blDataType,blBlockSize>  const_iterator;
+
+    typedef std::reverse_iterator<iterator>                         reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>                   const_reverse_iterator;
+
+    typedef std::allocator_traits<blAllocatorType>                  blAllocatorTraits;
+
+public: // Constructors and destructors
+
+    // Default constructor
+
+    explicit blSegmentedArray(const blAllocatorType& allocator = blAllocatorType())
+                              : m_size(0),
+                                m_allocator(allocator)
+    {
+    }
+
+    // Copy constructor
+
+    blSegmentedArray(const blSegmentedArray<blDataType,blBlockSize,blAllocatorType>& segmentedArray)
+                     : m_size(0),
+                       m_allocator(blAllocatorTraits::select_on_container_copy_construction(segmentedArray.get_allocator()))
+    {
+        this->reserve(segmentedArray.size());
+
+        for(const auto& value : segmentedArray)
+            this->push_back(value);
+    }
+
+    // Move constructor
+
+    blSegmentedArray(blSegmentedArray<blDataType,blBlockSize,blAllocatorType>&& segmentedArray) noexcept
+                     : m_blocks(std::move(segmentedArray.m_blocks)),
+                       m_size(segmentedArray.m_size),
+                       m_allocator(std::move(segmentedArray.m_allocator))
+    {
+        segmentedArray.m_blocks.clear();
+        segmentedArray.m_size = 0;
+    }
+
+    // Destructor
+
+    ~blSegmentedArray()
+    {
+        this->clear();
+    }
+
+public: // Assignment operators
+
+    blSegmentedArray<blDataType,blBlockSize,blAllocatorType>&   operator=(const blSegmentedArray<blDataType,blBlockSize,blAllocatorType>& segmentedArray)
+    {
+        if(this != &segmentedArray)
+        {
+            this->destroyElements();
+
+            for(const auto& value : segmentedArray)
+                this->push_back(value);
+        }
+
+        return (*this);
+    }
+
+    blSegmentedArray<blDataType,blBlockSize,blAllocatorType>&   operator=(blSegmentedArray<blDataType,blBlockSize,blAllocatorType>&& segmentedArray)
+    {
+        if(this != &segmentedArray)
+        {
+            this->clear();
+
+            m_blocks = std::move(segmentedArray.m_blocks);
+            m_size = segmentedArray.m_size;
+            m_allocator = std::move(segmentedArray.m_allocator);
+
+            segmentedArray.m_blocks.clear();
+            segmentedArray.m_size = 0;
+        }
+
+        return (*this);
+    }
+
+public: // Public functions
+
+    // Element access
+    // functions
+
+    blDataType&                                             operator[](const size_t& index){return m_blocks[index / blBlockSize][index % blBlockSize];}
+    const blDataType&                                       operator[](const size_t& index)const{return m_blocks[index / blBlockSize][index % blBlockSize];}
+
+    blDataType&                                             front(){return m_blocks[0][0];}
+    const blDataType&                                       front()const{return m_blocks[0][0];}
+    blDataType&                                             back(){return (*this)[m_size - 1];}
+    const blDataType&                                       back()const{return (*this)[m_size - 1];}
+
+    // Functions used to
+    // add elements at
+    // the back
+
+    template<typename... blArgumentTypes>
+    blDataType&                                             emplace_back(blArgumentTypes&&... arguments)
+    {
+        if(m_size == this->capacity())
+            this->allocateBlock();
+
+        blDataType* ptr = m_blocks[m_size / blBlockSize] + m_size % blBlockSize;
+
+        blAllocatorTraits::construct(m_allocator,ptr,std::forward<blArgumentTypes>(arguments)...);
+
+        ++m_size;
+
+        return (*ptr);
+    }
+
+    void                                                    push_back(const blDataType& value){this->emplace_back(value);}
+    void                                                    push_back(blDataType&& value){this->emplace_back(std::move(value));}
+
+    // Function used to add
+    // a span of elements,
+    // one block at a time
+
+    void                                                    push_back(const blDataType* values,
+                                                                      const size_t& numberOfValues);
+
+    // Function used to remove
+    // the last element (its
+    // block is kept)
+
+    void                                                    pop_back()
+    {
+        --m_size;
+        blAllocatorTraits::destroy(m_allocator,m_blocks[m_size / blBlockSize] + m_size % blBlockSize);
+    }
+
+    // Functions used to allocate
+    // blocks ahead of time and to
+    // give back the unused ones
+
+    void                                                    reserve(const size_t& capacity)
+    {
+        while(this->capacity() < capacity)
+            this->allocateBlock();
+    }
+
+    void                                                    shrink_to_fit()
+    {
+        while(this->capacity() >= m_size + blBlockSize)
+        {
+            blAllocatorTraits::deallocate(m_allocator,m_blocks.back(),blBlockSize);
+            m_blocks.pop_back();
+        }
+
+        m_blocks.shrink_to_fit();
+    }
+
+    // Function used to destroy
+    // the elements and give
+    // back the blocks
+
+    void                                                    clear()
+    {
+        this->destroyElements();
+
+        for(auto block : m_blocks)
+            blAllocatorTraits::deallocate(m_allocator,block,blBlockSize);
+
+        m_blocks.clear();
+    }
+
+    // Functions used
+    // to get the sizes
+
+    size_t                                                  length()const{return m_size;}
+    size_t                                                  size()const{return m_size;}
+    size_t                                                  max_size()const{return m_size;}
+    bool                                                    empty()const{return (m_size == 0);}
+    size_t                                                  capacity()const{return m_blocks.size() * blBlockSize;}
+
+    // Functions used to get
+    // the blocks holding the
+    // elements (the last one
+    // can be partially used)
+
+    size_t                                                  getNumberOfBlocks()const{return (m_size + blBlockSize - 1) / blBlockSize;}
+
+    blRawArrayWrapper<blDataType>                           getBlock(const size_t& blockIndex)
+    {
+        return blRawArrayWrapper<blDataType>(m_blocks[blockIndex],std::min(blBlockSize,m_size - blockIndex * blBlockSize));
+    }
+
+    blRawArrayWrapper<const blDataType>                     getBlock(const size_t& blockIndex)const
+    {
+        return blRawArrayWrapper<const blDataType>(m_blocks[blockIndex],std::min(blBlockSize,m_size - blockIndex * blBlockSize));
+    }
+
+    blAllocatorType                                         get_allocator()const{return m_allocator;}
+
+    // Functions used to
+    // get iterators to
+    // this container
+
+    iterator                                                begin(){return iterator(&m_blocks,0);}
+    iterator                                                end(){return iterator(&m_blocks,m_size);}
+    const_iterator                                          begin()const{return const_iterator(&m_blocks,0);}
+    const_iterator                                          end()const{return const_iterator(&m_blocks,m_size);}
+    const_iterator                                          cbegin()const{return const_iterator(&m_blocks,0);}
+    const_iterator                                          cend()const{return const_iterator(&m_blocks,m_size);}
+
+    reverse_iterator                                        rbegin(){return reverse_iterator(end());}
+    reverse_iterator                                        rend(){return reverse_iterator(begin());}
+    const_reverse_iterator                                  crbegin()const{return const_reverse_iterator(cend());}
+    const_reverse_iterator                                  crend()const{return const_reverse_iterator(cbegin());}
+
+private: // Private functions
+
+    // Function used to add a block,
+    // which is allocated before it's
+    // put in the table, so a failed
+    // allocation leaves no null block
+
+    void                                                    allocateBlock()
+    {
+        blDataType* block = blAllocatorTraits::allocate(m_allocator,blBlockSize);
+
+        try
+        {
+            m_blocks.push_back(block);
+        }
+        catch(...)
+        {
+            blAllocatorTraits::deallocate(m_allocator,block,blBlockSize);
+            throw;
+        }
+    }
+
+    void                                                    destroyElements()
+    {
+        for(; m_size > 0; --m_size)
+            blAllocatorTraits::destroy(m_allocator,m_blocks[(m_size - 1) / blBlockSize] + (m_size - 1) % blBlockSize);
+    }
+
+private: // Private variables
+
+    // The table of blocks,
+    // the number of elements
+    // and the allocator used
+    // to get the blocks
+
+    std::vector<blDataType*>                                m_blocks;
+    size_t                                                  m_size;
+    blAllocatorType                                         m_allocator;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blBlockSize,typename blAllocatorType>
+inline void blSegmentedArray<blDataType,blBlockSize,blAllocatorType>::push_back(const blDataType* values,
+                                                                                const size_t& numberOfValues)
+{
+    this->reserve(m_size + numberOfValues);
+
+    size_t numberOfPushedValues = 0;
+
+    while(numberOfPushedValues < numberOfValues)
+    {
+        blDataType* block = m_blocks[m_size / blBlockSize];
+        size_t offset = m_size % blBlockSize;
+        size_t numberOfValuesToPush = std::min(blBlockSize - offset,numberOfValues - numberOfPushedValues);
+
+        for(size_t i = 0; i < numberOfValuesToPush; ++i)
+        {
+            blAllocatorTraits::construct(m_allocator,block + offset + i,values[numberOfPushedValues + i]);
+            ++m_size;
+        }
+
+        numberOfPushedValues += numberOfValuesToPush;
+    }
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SEGMENTEDARRAY_HPP
@@ -0,0 +1,1137 @@
+#ifndef BL_SIMDALGORITHMS_HPP
+#define BL_SIMDALGORITHMS_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSimdAlgorithms.hpp
+// CLASS:           blIsEqualTo
+//                  blIsNotEqualTo
+//                  blIsLessThan
+//                  blIsLessThanOrEqualTo
+//                  blIsGreaterThan
+//                  blIsGreaterThanOrEqualTo
+// BASE CLASS:      None
+//
+// PURPOSE:         Vectorized algorithms over contiguous arrays
+//                  of arithmetic types:
+//
+//                  - blFind, blFindIf -- Like std::find/find_if
+//                  - blCount, blCountIf -- Like std::count/count_if
+//                  - blMinElement, blMaxElement,
+//                    blMinMaxElement -- Like std::min_element,
+//                                       std::max_element and
+//                                       std::minmax_element
+//                  - blSum -- Like std::accumulate, adding
+//                             integers as 64-bit integers and
+//                             floats as doubles
+//
+//                  blFindIf and blCountIf take one of the simple
+//                  comparison predicates defined here, which can
+//                  compare a whole vector of elements at once.
+//
+//                  The algorithms work on raw pointers and on
+//                  blIterator ranges over contiguous containers,
+//                  which get resolved into (at most) two contiguous
+//                  segments, so a circular range wrapping around
+//                  its container's end is handled as two arrays.
+//                  Ranges over segmented containers (blSegmentedArray)
+//                  are further split at the end of every block
+//                  (blForEachSegment).
+//
+//                  The widest instruction set the cpu supports
+//                  (SSE2, AVX2 or AVX-512) is chosen at run time,
+//                  with plain loops used everywhere else.
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blIterator
+//                  - blRawArrayWrapper
+//                  - blIteratorTraits
+//
+// NOTES:           - The vector code uses gcc/clang vector
+//                    extensions compiled for each instruction
+//                    set through target attributes, so it's
+//                    only enabled for gcc/clang on x86, other
+//                    compilers and cpus use the plain loops
+//
+//                  - Arrays containing NaNs give unspecified
+//                    min/max results
+//
+//                  - A blIterator range [first,last) covers
+//                    (last - first) elements, so a circular
+//                    range can't cover its whole container
+//                    (first == last is an empty range)
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The vector code is only
+// compiled for gcc/clang on x86
+//-------------------------------------------------------------------
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define BL_SIMD_ENABLED
+    #define BL_SIMD_ALWAYS_INLINE __attribute__((always_inline))
+#else
+    #define BL_SIMD_ALWAYS_INLINE
+#endif
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The instruction sets the
+// algorithms can use
+//-------------------------------------------------------------------
+enum blSimdLevel
+{
+    blSimdScalar,
+    blSimdSSE2,
+    blSimdAVX2,
+    blSimdAVX512
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to get the widest
+// instruction set the cpu supports,
+// it's only detected once
+//-------------------------------------------------------------------
+inline blSimdLevel blDetectSimdLevel()
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        __builtin_cpu_init();
+
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            return blSimdAVX512;
+
+        if(__builtin_cpu_supports("avx2"))
+            return blSimdAVX2;
+
+        if(__builtin_cpu_supports("sse2"))
+            return blSimdSSE2;
+
+    #endif
+
+    return blSimdScalar;
+}
+
+inline blSimdLevel blGetSimdLevel()
+{
+    static const blSimdLevel simdLevel = blDetectSimdLevel();
+    return simdLevel;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Whether arrays of a type can use
+// the vector code (integers, floats
+// and doubles)
+//-------------------------------------------------------------------
+template<typename blDataType>
+struct blIsSimdType : std::integral_constant<bool,
+                                             (std::is_integral<blDataType>::value && !std::is_same<blDataType,bool>::value && sizeof(blDataType) <= 8) ||
+                                             std::is_same<blDataType,float>::value ||
+                                             std::is_same<blDataType,double>::value>
+{
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The type sums of a type are
+// added into (64-bit integers
+// for integers, doubles for
+// floats)
+//-------------------------------------------------------------------
+template<typename blDataType,typename blEnable = void>
+struct blSumType
+{
+    typedef blDataType                                      type;
+};
+
+template<typename blDataType>
+struct blSumType<blDataType,typename std::enable_if<std::is_integral<blDataType>::value && !std::is_same<blDataType,bool>::value>::type>
+{
+    typedef typename std::conditional<std::is_signed<blDataType>::value,int64_t,uint64_t>::type     type;
+};
+
+template<>
+struct blSumType<float>
+{
+    typedef double                                          type;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The comparison predicates
+//
+// NOTE:    Besides comparing one element,
+//          each predicate compares a whole
+//          vector of elements at once through
+//          "getMask", setting the lanes of
+//          the elements that pass to all ones
+//-------------------------------------------------------------------
+#define BL_DEFINE_SIMD_PREDICATE(blPredicateName,blOperator)                                   \
+template<typename blDataType>                                                               \
+struct blPredicateName                                                                      \
+{                                                                                           \
+    blPredicateName(const blDataType& value) : m_value(value)                               \
+    {                                                                                       \
+    }                                                                                       \
+                                                                                            \
+    bool                                operator()(const blDataType& value)const            \
+    {                                                                                       \
+        return (value blOperator m_value);                                                  \
+    }                                                                                       \
+                                                                                            \
+    template<typename blVectorType,typename blMaskType>                                     \
+    inline BL_SIMD_ALWAYS_INLINE void   getMask(const blVectorType& values,                 \
+                                                blMaskType& mask)const                      \
+    {                                                                                       \
+        mask = (values blOperator m_value);                                                 \
+    }                                                                                       \
+                                                                                            \
+    blDataType                          m_value;                                            \
+};
+
+BL_DEFINE_SIMD_PREDICATE(blIsEqualTo,==)
+BL_DEFINE_SIMD_PREDICATE(blIsNotEqualTo,!=)
+BL_DEFINE_SIMD_PREDICATE(blIsLessThan,<)
+BL_DEFINE_SIMD_PREDICATE(blIsLessThanOrEqualTo,<=)
+BL_DEFINE_SIMD_PREDICATE(blIsGreaterThan,>)
+BL_DEFINE_SIMD_PREDICATE(blIsGreaterThanOrEqualTo,>=)
+
+#undef BL_DEFINE_SIMD_PREDICATE
+//-------------------------------------------------------------------
+
+
+#if defined(BL_SIMD_ENABLED)
+
+
+//-------------------------------------------------------------------
+// The vector types of a given width
+// in bytes, and their masks
+//-------------------------------------------------------------------
+template<typename blDataType,size_t blVectorBytes>
+struct blSimdVector
+{
+    typedef blDataType                                      type __attribute__((vector_size(blVectorBytes)));
+
+    typedef decltype(std::declval<type>() == std::declval<type>())   blMaskType;
+
+    static const size_t                                     blNumberOfLanes = blVectorBytes / sizeof(blDataType);
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The kernels, written once for every
+// vector width and compiled for each
+// instruction set by the functions
+// below them
+//
+// NOTE:    They're always inlined, so
+//          they pick up the instruction
+//          set of their caller
+//-------------------------------------------------------------------
+template<size_t blVectorBytes,typename blDataType>
+inline BL_SIMD_ALWAYS_INLINE void blSimdLoad(const blDataType* data,
+                                                      typename blSimdVector<blDataType,blVectorBytes>::type& values)
+{
+    std::memcpy(&values,data,blVectorBytes);
+}
+
+// Whether any lane of four masks is set
+//
+// NOTE:    The masks are or'ed as 64-bit
+//          words, which keeps gcc from
+//          falling back to scalar code
+//          for some AVX-512 comparisons
+
+template<size_t blVectorBytes,typename blMaskType>
+inline BL_SIMD_ALWAYS_INLINE bool blSimdAny(const blMaskType& mask0,
+                                            const blMaskType& mask1,
+                                            const blMaskType& mask2,
+                                            const blMaskType& mask3)
+{
+    typedef typename blSimdVector<uint64_t,blVectorBytes>::type blWordsType;
+
+    blWordsType words = ((blWordsType)mask0 | (blWordsType)mask1) | ((blWordsType)mask2 | (blWordsType)mask3);
+
+    uint64_t anyBits = 0;
+
+    for(size_t i = 0; i < blVectorBytes / 8; ++i)
+        anyBits |= words[i];
+
+    return (anyBits != 0);
+}
+
+// Find the first element passing
+// the predicate, testing four
+// vectors at a time
+
+template<size_t blVectorBytes,typename blDataType,typename blPredicateType>
+inline BL_SIMD_ALWAYS_INLINE const blDataType* blSimdFindIfKernel(const blDataType* begin,
+                                                                           const blDataType* end,
+                                                                           const blPredicateType& predicate)
+{
+    typedef blSimdVector<blDataType,blVectorBytes>          blVector;
+
+    const ptrdiff_t blockSize = 4 * blVector::blNumberOfLanes;
+
+    while(end - begin >= blockSize)
+    {
+        const blDataType* block = begin;
+
+        typename blVector::type values0,values1,values2,values3;
+        typename blVector::blMaskType mask0,mask1,mask2,mask3;
+
+        blSimdLoad<blVectorBytes>(block,values0);
+        blSimdLoad<blVectorBytes>(block + blVector::blNumberOfLanes,values1);
+        blSimdLoad<blVectorBytes>(block + 2 * blVector::blNumberOfLanes,values2);
+        blSimdLoad<blVectorBytes>(block + 3 * blVector::blNumberOfLanes,values3);
+
+        predicate.getMask(values0,mask0);
+        predicate.getMask(values1,mask1);
+        predicate.getMask(values2,mask2);
+        predicate.getMask(values3,mask3);
+
+        if(blSimdAny<blVectorBytes>(mask0,mask1,mask2,mask3))
+            break;
+
+        begin += blockSize;
+    }
+
+    for(; begin != end; ++begin)
+    {
+        if(predicate(*begin))
+            return begin;
+    }
+
+    return end;
+}
+
+// Find the last element passing
+// the predicate, it returns "end"
+// when none passes
+
+template<size_t blVectorBytes,typename blDataType,typename blPredicateType>
+inline BL_SIMD_ALWAYS_INLINE const blDataType* blSimdFindLastIfKernel(const blDataType* begin,
+                                                                               const blDataType* end,
+                                                                               const blPredicateType& predicate)
+{
+    typedef blSimdVector<blDataType,blVectorBytes>          blVector;
+
+    const ptrdiff_t blockSize = 4 * blVector::blNumberOfLanes;
+
+    const blDataType* current = end;
+
+    while(current - begin >= blockSize)
+    {
+        const blDataType* block = current - blockSize;
+
+        typename blVector::type values0,values1,values2,values3;
+        typename blVector::blMaskType mask0,mask1,mask2,mask3;
+
+        blSimdLoad<blVectorBytes>(block,values0);
+        blSimdLoad<blVectorBytes>(block + blVector::blNumberOfLanes,values1);
+        blSimdLoad<blVectorBytes>(block + 2 * blVector::blNumberOfLanes,values2);
+        blSimdLoad<blVectorBytes>(block + 3 * blVector::blNumberOfLanes,values3);
+
+        predicate.getMask(values0,mask0);
+        predicate.getMask(values1,mask1);
+        predicate.getMask(values2,mask2);
+        predicate.getMask(values3,mask3);
+
+        if(blSimdAny<blVectorBytes>(mask0,mask1,mask2,mask3))
+            break;
+
+        current -= blockSize;
+    }
+
+    while(current != begin)
+    {
+        --current;
+
+        if(predicate(*current))
+            return current;
+    }
+
+    return end;
+}
+
+// Count the elements passing
+// the predicate
+//
+// NOTE:    Every passing lane adds one
+//          to a lane counter, which is
+//          emptied before it can overflow
+
+template<size_t blVectorBytes,typename blDataType,typename blPredicateType>
+inline BL_SIMD_ALWAYS_INLINE size_t blSimdCountIfKernel(const blDataType* begin,
+                                                                 const blDataType* end,
+                                                                 const blPredicateType& predicate)
+{
+    typedef blSimdVector<blDataType,blVectorBytes>          blVector;
+    typedef typename blVector::blMaskType                   blMaskType;
+    typedef typename std::make_unsigned<typename std::remove_reference<decltype(std::declval<blMaskType>()[0])>::type>::type blLaneType;
+    typedef typename blSimdVector<blLaneType,blVectorBytes>::type   blCountsType;
+
+    const ptrdiff_t numberOfLanes = blVector::blNumberOfLanes;
+    const size_t maxVectorsPerBatch = (sizeof(blLaneType) >= 4) ? size_t(0x7FFFFFFF) : size_t(blLaneType(~blLaneType(0)));
+
+    size_t numberOfElements = 0;
+
+    while(end - begin >= numberOfLanes)
+    {
+        blCountsType counts = blCountsType();
+
+        for(size_t i = 0; i < maxVectorsPerBatch && end - begin >= numberOfLanes; ++i,begin += numberOfLanes)
+        {
+            typename blVector::type values;
+            blMaskType mask;
+
+            blSimdLoad<blVectorBytes>(begin,values);
+            predicate.getMask(values,mask);
+
+            counts -= (blCountsType)mask;
+        }
+
+        for(ptrdiff_t i = 0; i < numberOfLanes; ++i)
+            numberOfElements += counts[i];
+    }
+
+    for(; begin != end; ++begin)
+    {
+        if(predicate(*begin))
+            ++numberOfElements;
+    }
+
+    return numberOfElements;
+}
+
+// Get the min and max values
+
+template<size_t blVectorBytes,typename blDataType>
+inline BL_SIMD_ALWAYS_INLINE void blSimdMinMaxKernel(const blDataType* begin,
+                                                              const blDataType* end,
+                                                              blDataType& minValue,
+                                                              blDataType& maxValue)
+{
+    typedef blSimdVector<blDataType,blVectorBytes>          blVector;
+
+    const ptrdiff_t numberOfLanes = blVector::blNumberOfLanes;
+
+    minValue = (*begin);
+    maxValue = (*begin);
+
+    if(end - begin >= numberOfLanes)
+    {
+        typename blVector::type minValues;
+        typename blVector::type maxValues;
+
+        blSimdLoad<blVectorBytes>(begin,minValues);
+        maxValues = minValues;
+
+        for(begin += numberOfLanes; end - begin >= numberOfLanes; begin += numberOfLanes)
+        {
+            typename blVector::type values;
+            blSimdLoad<blVectorBytes>(begin,values);
+
+            minValues = (values < minValues) ? values : minValues;
+            maxValues = (values > maxValues) ? values : maxValues;
+        }
+
+        for(ptrdiff_t i = 0; i < numberOfLanes; ++i)
+        {
+            if(minValues[i] < minValue)
+                minValue = minValues[i];
+
+            if(maxValues[i] > maxValue)
+                maxValue = maxValues[i];
+        }
+    }
+
+    for(; begin != end; ++begin)
+    {
+        if((*begin) < minValue)
+            minValue = (*begin);
+
+        if((*begin) > maxValue)
+            maxValue = (*begin);
+    }
+}
+
+// Add up the elements, converting
+// each vector of elements to a
+// vector of their sum type, and
+// keeping four partial sums
+
+template<size_t blVectorBytes,typename blDataType>
+inline BL_SIMD_ALWAYS_INLINE typename blSumType<blDataType>::type blSimdSumKernel(const blDataType* begin,
+                                                                                           const blDataType* end)
+{
+    typedef typename blSumType<blDataType>::type            blSumDataType;
+    typedef blSimdVector<blSumDataType,blVectorBytes>       blSumVector;
+    typedef blSimdVector<blDataType,blVectorBytes * sizeof(blDataType) / sizeof(blSumDataType)>  blVector;
+
+    const ptrdiff_t numberOfLanes = blSumVector::blNumberOfLanes;
+
+    blSumDataType sum = 0;
+
+    if(end - begin >= 4 * numberOfLanes)
+    {
+        typename blSumVector::type sums[4] = {};
+
+        for(; end - begin >= 4 * numberOfLanes; begin += 4 * numberOfLanes)
+        {
+            for(ptrdiff_t j = 0; j < 4; ++j)
+            {
+                typename blVector::type values;
+                std::memcpy(&values,begin + j * numberOfLanes,sizeof(values));
+
+                sums[j] += __builtin_convertvector(values,typename blSumVector::type);
+            }
+        }
+
+        sums[0] += sums[1] + sums[2] + sums[3];
+
+        for(ptrdiff_t i = 0; i < numberOfLanes; ++i)
+            sum += sums[0][i];
+    }
+
+    for(; begin != end; ++begin)
+        sum += static_cast<blSumDataType>(*begin);
+
+    return sum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The kernels compiled for each
+// instruction set
+//-------------------------------------------------------------------
+#define BL_DEFINE_SIMD_KERNELS(blSuffix,blTarget,blVectorBytes)                                \
+template<typename blDataType,typename blPredicateType>                                      \
+__attribute__((target(blTarget))) const blDataType* blSimdFindIf##blSuffix(const blDataType* begin,const blDataType* end,const blPredicateType& predicate)   \
+{                                                                                           \
+    return blSimdFindIfKernel<blVectorBytes>(begin,end,predicate);                          \
+}                                                                                           \
+                                                                                            \
+template<typename blDataType,typename blPredicateType>                                      \
+__attribute__((target(blTarget))) const blDataType* blSimdFindLastIf##blSuffix(const blDataType* begin,const blDataType* end,const blPredicateType& predicate)   \
+{                                                                                           \
+    return blSimdFindLastIfKernel<blVectorBytes>(begin,end,predicate);                      \
+}                                                                                           \
+                                                                                            \
+template<typename blDataType,typename blPredicateType>                                      \
+__attribute__((target(blTarget))) size_t blSimdCountIf##blSuffix(const blDataType* begin,const blDataType* end,const blPredicateType& predicate)   \
+{                                                                                           \
+    return blSimdCountIfKernel<blVectorBytes>(begin,end,predicate);                         \
+}                                                                                           \
+                                                                                            \
+template<typename blDataType>                                                               \
+__attribute__((target(blTarget))) void blSimdMinMax##blSuffix(const blDataType* begin,const blDataType* end,blDataType& minValue,blDataType& maxValue)   \
+{                                                                                           \
+    blSimdMinMaxKernel<blVectorBytes>(begin,end,minValue,maxValue);                         \
+}                                                                                           \
+                                                                                            \
+template<typename blDataType>                                                               \
+__attribute__((target(blTarget))) typename blSumType<blDataType>::type blSimdSum##blSuffix(const blDataType* begin,const blDataType* end)   \
+{                                                                                           \
+    return blSimdSumKernel<blVectorBytes>(begin,end);                                       \
+}
+
+BL_DEFINE_SIMD_KERNELS(SSE2,"sse2",16)
+BL_DEFINE_SIMD_KERNELS(AVX2,"avx2",32)
+BL_DEFINE_SIMD_KERNELS(AVX512,"avx512f,avx512bw,avx512dq",64)
+
+#undef BL_DEFINE_SIMD_KERNELS
+//-------------------------------------------------------------------
+
+
+#endif // BL_SIMD_ENABLED
+
+
+//-------------------------------------------------------------------
+// The dispatching functions, choosing
+// the kernel of the given instruction
+// set, or a plain loop
+//-------------------------------------------------------------------
+template<typename blDataType,typename blPredicateType>
+inline const blDataType* blSimdFindIf(const blDataType* begin,
+                                      const blDataType* end,
+                                      const blPredicateType& predicate,
+                                      const blSimdLevel& simdLevel)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        switch(simdLevel)
+        {
+        case blSimdAVX512:  return blSimdFindIfAVX512(begin,end,predicate);
+        case blSimdAVX2:    return blSimdFindIfAVX2(begin,end,predicate);
+        case blSimdSSE2:    return blSimdFindIfSSE2(begin,end,predicate);
+        default:            break;
+        }
+
+    #endif
+
+    return std::find_if(begin,end,predicate);
+}
+
+template<typename blDataType,typename blPredicateType>
+inline const blDataType* blSimdFindLastIf(const blDataType* begin,
+                                          const blDataType* end,
+                                          const blPredicateType& predicate,
+                                          const blSimdLevel& simdLevel)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        switch(simdLevel)
+        {
+        case blSimdAVX512:  return blSimdFindLastIfAVX512(begin,end,predicate);
+        case blSimdAVX2:    return blSimdFindLastIfAVX2(begin,end,predicate);
+        case blSimdSSE2:    return blSimdFindLastIfSSE2(begin,end,predicate);
+        default:            break;
+        }
+
+    #endif
+
+    for(const blDataType* current = end; current != begin;)
+    {
+        --current;
+
+        if(predicate(*current))
+            return current;
+    }
+
+    return end;
+}
+
+template<typename blDataType,typename blPredicateType>
+inline size_t blSimdCountIf(const blDataType* begin,
+                            const blDataType* end,
+                            const blPredicateType& predicate,
+                            const blSimdLevel& simdLevel)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        switch(simdLevel)
+        {
+        case blSimdAVX512:  return blSimdCountIfAVX512(begin,end,predicate);
+        case blSimdAVX2:    return blSimdCountIfAVX2(begin,end,predicate);
+        case blSimdSSE2:    return blSimdCountIfSSE2(begin,end,predicate);
+        default:            break;
+        }
+
+    #endif
+
+    return static_cast<size_t>(std::count_if(begin,end,predicate));
+}
+
+template<typename blDataType>
+inline void blSimdMinMax(const blDataType* begin,
+                         const blDataType* end,
+                         blDataType& minValue,
+                         blDataType& maxValue,
+                         const blSimdLevel& simdLevel)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        switch(simdLevel)
+        {
+        case blSimdAVX512:  blSimdMinMaxAVX512(begin,end,minValue,maxValue);return;
+        case blSimdAVX2:    blSimdMinMaxAVX2(begin,end,minValue,maxValue);return;
+        case blSimdSSE2:    blSimdMinMaxSSE2(begin,end,minValue,maxValue);return;
+        default:            break;
+        }
+
+    #endif
+
+    minValue = (*begin);
+    maxValue = (*begin);
+
+    for(; begin != end; ++begin)
+    {
+        if((*begin) < minValue)
+            minValue = (*begin);
+
+        if((*begin) > maxValue)
+            maxValue = (*begin);
+    }
+}
+
+template<typename blDataType>
+inline typename blSumType<blDataType>::type blSimdSum(const blDataType* begin,
+                                                      const blDataType* end,
+                                                      const blSimdLevel& simdLevel)
+{
+    #if defined(BL_SIMD_ENABLED)
+
+        switch(simdLevel)
+        {
+        case blSimdAVX512:  return blSimdSumAVX512(begin,end);
+        case blSimdAVX2:    return blSimdSumAVX2(begin,end);
+        case blSimdSSE2:    return blSimdSumSSE2(begin,end);
+        default:            break;
+        }
+
+    #endif
+
+    typename blSumType<blDataType>::type sum = typename blSumType<blDataType>::type();
+
+    for(; begin != end; ++begin)
+        sum += static_cast<typename blSumType<blDataType>::type>(*begin);
+
+    return sum;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Types which can't use the
+// vector code use plain loops
+//-------------------------------------------------------------------
+template<typename blDataType>
+inline blSimdLevel blGetSimdLevelForType()
+{
+    return (blIsSimdType<typename std::remove_cv<blDataType>::type>::value ? blGetSimdLevel() : blSimdScalar);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The algorithms over raw arrays
+//
+// NOTE:    Like the std algorithms they
+//          return "end" when nothing is
+//          found, blMinElement returns
+//          the first min, blMaxElement
+//          the first max and blMinMaxElement
+//          the first min and the last max
+//-------------------------------------------------------------------
+template<typename blDataType,typename blPredicateType>
+inline blDataType* blFindIf(blDataType* begin,
+                            blDataType* end,
+                            const blPredicateType& predicate)
+{
+    return begin + (blSimdFindIf<typename std::remove_const<blDataType>::type>(begin,end,predicate,blGetSimdLevelForType<blDataType>()) - begin);
+}
+
+template<typename blDataType>
+inline blDataType* blFind(blDataType* begin,
+                          blDataType* end,
+                          const typename std::remove_const<blDataType>::type& value)
+{
+    return blFindIf(begin,end,blIsEqualTo<typename std::remove_const<blDataType>::type>(value));
+}
+
+template<typename blDataType,typename blPredicateType>
+inline size_t blCountIf(blDataType* begin,
+                        blDataType* end,
+                        const blPredicateType& predicate)
+{
+    return blSimdCountIf<typename std::remove_const<blDataType>::type>(begin,end,predicate,blGetSimdLevelForType<blDataType>());
+}
+
+template<typename blDataType>
+inline size_t blCount(blDataType* begin,
+                      blDataType* end,
+                      const typename std::remove_const<blDataType>::type& value)
+{
+    return blCountIf(begin,end,blIsEqualTo<typename std::remove_const<blDataType>::type>(value));
+}
+
+template<typename blDataType>
+inline blDataType* blMinElement(blDataType* begin,
+                                blDataType* end)
+{
+    if(begin == end)
+        return end;
+
+    typename std::remove_const<blDataType>::type minValue,maxValue;
+
+    blSimdMinMax<typename std::remove_const<blDataType>::type>(begin,end,minValue,maxValue,blGetSimdLevelForType<blDataType>());
+
+    return blFind(begin,end,minValue);
+}
+
+template<typename blDataType>
+inline blDataType* blMaxElement(blDataType* begin,
+                                blDataType* end)
+{
+    if(begin == end)
+        return end;
+
+    typename std::remove_const<blDataType>::type minValue,maxValue;
+
+    blSimdMinMax<typename std::remove_const<blDataType>::type>(begin,end,minValue,maxValue,blGetSimdLevelForType<blDataType>());
+
+    return blFind(begin,end,maxValue);
+}
+
+template<typename blDataType>
+inline std::pair<blDataType*,blDataType*> blMinMaxElement(blDataType* begin,
+                                                          blDataType* end)
+{
+    typedef typename std::remove_const<blDataType>::type    blValueType;
+
+    if(begin == end)
+        return std::make_pair(end,end);
+
+    blValueType minValue,maxValue;
+
+    blSimdMinMax<blValueType>(begin,end,minValue,maxValue,blGetSimdLevelForType<blDataType>());
+
+    const blValueType* lastMax = blSimdFindLastIf<blValueType>(begin,end,blIsEqualTo<blValueType>(maxValue),blGetSimdLevelForType<blDataType>());
+
+    return std::make_pair(blFind(begin,end,minValue),
+                          begin + (lastMax - begin));
+}
+
+template<typename blDataType>
+inline typename blSumType<typename std::remove_const<blDataType>::type>::type blSum(blDataType* begin,
+                                                                                  blDataType* end)
+{
+    return blSimdSum<typename std::remove_const<blDataType>::type>(begin,end,blGetSimdLevelForType<blDataType>());
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Functions used to resolve a blIterator
+// range [first,last) over a contiguous
+// container into two contiguous segments
+//
+// NOTE:    The second segment is only
+//          non empty when the range wraps
+//          around the container's end
+//          (for circular iterators)
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blBatchType
+getFirstSegment(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>   blIteratorType;
+
+    static_assert(blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value,
+                  "Segments are only available for ranges over contiguous containers");
+
+    ptrdiff_t numberOfElements = std::min(last - first,first.getDistanceFromIterToEnd());
+
+    if(numberOfElements <= 0)
+        return typename blIteratorType::blBatchType();
+
+    return typename blIteratorType::blBatchType(getDataPointer(first.getPtr()),
+                                                static_cast<size_t>(numberOfElements));
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blBatchType
+getSecondSegment(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                 const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>   blIteratorType;
+
+    static_assert(blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value,
+                  "Segments are only available for ranges over contiguous containers");
+
+    ptrdiff_t numberOfElements = (last - first) - first.getDistanceFromIterToEnd();
+
+    if(numberOfElements <= 0)
+        return typename blIteratorType::blBatchType();
+
+    return typename blIteratorType::blBatchType(getDataPointer(first.begin().getPtr()),
+                                                static_cast<size_t>(numberOfElements));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// Function used to walk a blIterator
+// range [first,last) one contiguous
+// piece of memory at a time, calling
+// functor(begin,end,offset) for each
+// piece, where offset is the distance
+// of the piece from first
+//
+// NOTE:    - Ranges over contiguous
+//            containers give one piece
+//            per lap (two when a circular
+//            range wraps once), ranges
+//            over segmented containers
+//            also get split at the end
+//            of every block
+//
+//          - The functor returns false
+//            to stop the walk
+//-------------------------------------------------------------------
+template<typename blRawIteratorType,typename blFunctorType>
+inline bool blForEachSegment(blRawIteratorType rawIterator,
+                             ptrdiff_t numberOfElements,
+                             ptrdiff_t& offset,
+                             blFunctorType& functor)
+{
+    while(numberOfElements > 0)
+    {
+        ptrdiff_t segmentLength = getContiguousLength(rawIterator,numberOfElements);
+
+        auto segmentBegin = getDataPointer(rawIterator);
+
+        if(!functor(segmentBegin,segmentBegin + segmentLength,offset))
+            return false;
+
+        offset += segmentLength;
+        numberOfElements -= segmentLength;
+        rawIterator += segmentLength;
+    }
+
+    return true;
+}
+
+// The "numberOfElements" elements
+// starting at first (a circular
+// range can go around its container
+// more than once)
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blFunctorType>
+inline void blForEachSegment(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                             ptrdiff_t numberOfElements,
+                             blFunctorType functor)
+{
+    typedef blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>   blIteratorType;
+
+    static_assert(blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value ||
+                  blIsSegmentedIterator<typename blIteratorType::iterator>::value,
+                  "Segments are only available for ranges over contiguous or segmented containers");
+
+    ptrdiff_t offset = 0;
+
+    if(numberOfElements <= 0)
+        return;
+
+    ptrdiff_t pieceLength = std::min(numberOfElements,first.getDistanceFromIterToEnd());
+
+    if(!blForEachSegment(first.getPtr(),pieceLength,offset,functor))
+        return;
+
+    numberOfElements -= pieceLength;
+
+    ptrdiff_t size = first.getDistanceFromBeginToIter() + first.getDistanceFromIterToEnd();
+
+    while(numberOfElements > 0 && size > 0)
+    {
+        pieceLength = std::min(numberOfElements,size);
+
+        if(!blForEachSegment(first.begin().getPtr(),pieceLength,offset,functor))
+            return;
+
+        numberOfElements -= pieceLength;
+    }
+}
+
+// The range [first,last)
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blFunctorType>
+inline void blForEachSegment(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                             const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                             blFunctorType functor)
+{
+    blForEachSegment(first,last - first,functor);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+// The algorithms over blIterator ranges,
+// running the raw array algorithms on
+// each segment of the range
+//-------------------------------------------------------------------
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blPredicateType>
+inline blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>
+blFindIf(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+         const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+         const blPredicateType& predicate)
+{
+    ptrdiff_t foundIndex = last - first;
+
+    blForEachSegment(first,last,[&](const decltype(getDataPointer(first.getPtr())) begin,const decltype(getDataPointer(first.getPtr())) end,const ptrdiff_t& offset)
+    {
+        auto found = blFindIf(begin,end,predicate);
+
+        if(found == end)
+            return true;
+
+        foundIndex = offset + (found - begin);
+
+        return false;
+    });
+
+    return first + foundIndex;
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blValueType>
+inline blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>
+blFind(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+       const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+       const blValueType& value)
+{
+    typedef typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType   blDataType;
+
+    return blFindIf(first,last,blIsEqualTo<blDataType>(value));
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blPredicateType>
+inline size_t blCountIf(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                        const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                        const blPredicateType& predicate)
+{
+    size_t count = 0;
+
+    blForEachSegment(first,last,[&](const decltype(getDataPointer(first.getPtr())) begin,const decltype(getDataPointer(first.getPtr())) end,const ptrdiff_t&)
+    {
+        count += blCountIf(begin,end,predicate);
+        return true;
+    });
+
+    return count;
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType,typename blValueType>
+inline size_t blCount(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                      const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last,
+                      const blValueType& value)
+{
+    typedef typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType   blDataType;
+
+    return blCountIf(first,last,blIsEqualTo<blDataType>(value));
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline std::pair<blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>,
+                 blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType> >
+blMinMaxElement(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+                const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef decltype(getDataPointer(first.getPtr()))          blPointerType;
+
+    blPointerType minPtr = nullptr;
+    blPointerType maxPtr = nullptr;
+    ptrdiff_t minIndex = last - first;
+    ptrdiff_t maxIndex = last - first;
+
+    // A later segment's min only
+    // wins when it's smaller, while
+    // its max wins when it's not
+    // smaller (the last max is kept)
+
+    blForEachSegment(first,last,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t& offset)
+    {
+        auto minMax = blMinMaxElement(begin,end);
+
+        if(minPtr == nullptr || (*minMax.first) < (*minPtr))
+        {
+            minPtr = minMax.first;
+            minIndex = offset + (minMax.first - begin);
+        }
+
+        if(maxPtr == nullptr || !((*minMax.second) < (*maxPtr)))
+        {
+            maxPtr = minMax.second;
+            maxIndex = offset + (minMax.second - begin);
+        }
+
+        return true;
+    });
+
+    return std::make_pair(first + minIndex,
+                          first + maxIndex);
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>
+blMinElement(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+             const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef decltype(getDataPointer(first.getPtr()))          blPointerType;
+
+    blPointerType minPtr = nullptr;
+    ptrdiff_t minIndex = last - first;
+
+    blForEachSegment(first,last,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t& offset)
+    {
+        auto minIter = blMinElement(begin,end);
+
+        if(minPtr == nullptr || (*minIter) < (*minPtr))
+        {
+            minPtr = minIter;
+            minIndex = offset + (minIter - begin);
+        }
+
+        return true;
+    });
+
+    return first + minIndex;
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>
+blMaxElement(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+             const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef decltype(getDataPointer(first.getPtr()))          blPointerType;
+
+    blPointerType maxPtr = nullptr;
+    ptrdiff_t maxIndex = last - first;
+
+    blForEachSegment(first,last,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t& offset)
+    {
+        auto maxIter = blMaxElement(begin,end);
+
+        if(maxPtr == nullptr || (*maxPtr) < (*maxIter))
+        {
+            maxPtr = maxIter;
+            maxIndex = offset + (maxIter - begin);
+        }
+
+        return true;
+    });
+
+    return first + maxIndex;
+}
+
+template<typename blContainerType,typename blAdvanceDistanceFunctorType,typename blBeginEndFunctorType,typename blInstrumentationType>
+inline typename blSumType<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType>::type
+blSum(const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& first,
+      const blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>& last)
+{
+    typedef decltype(getDataPointer(first.getPtr()))          blPointerType;
+
+    typename blSumType<typename blIterator<blContainerType,blAdvanceDistanceFunctorType,blBeginEndFunctorType,blInstrumentationType>::blDataType>::type sum = 0;
+
+    blForEachSegment(first,last,[&](const blPointerType begin,const blPointerType end,const ptrdiff_t&)
+    {
+        sum += blSum(begin,end);
+        return true;
+    });
+
+    return sum;
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SIMDALGORITHMS_HPP
@@ -0,0 +1,456 @@
+#ifndef BL_SLIDINGWINDOW_HPP
+#define BL_SLIDINGWINDOW_HPP
+
+
+//-------------------------------------------------------------------
+// FILE:            blSlidingWindow.hpp
+// CLASS:           blSlidingWindow
+// BASE CLASS:      None
+//
+// PURPOSE:         A window sliding over a container through
+//                  circular iterators (like over a ring buffer),
+//                  which keeps the window's aggregates up to
+//                  date as it slides instead of re-scanning the
+//                  window on every step:
+//
+//                  - sum, mean and variance in O(1)
+//
+//                  - min and max in amortized O(1), using
+//                    monotonic deques stored in blArrays
+//
+//                  When the container is contiguous, the window
+//                  can also be accessed as at most two contiguous
+//                  segments (two when it wraps around).
+//
+// AUTHOR:          Vincenzo Barbato
+//                  http://www.barbatolabs.com
+//                  navyenzo@gmail.com
+//
+// LISENSE:         MIT-LICENCE
+//                  http://www.opensource.org/licenses/mit-license.php
+//
+// DEPENDENCIES:    - blCircularIterator
+//                  - blArray
+//                  - blRawArrayWrapper
+//
+// NOTES:           - The window size is chosen at run time but
+//                    cannot be bigger than "blMaxWindowSize",
+//                    which sizes the monotonic deques
+//
+//                  - The mean and variance are updated with
+//                    Welford's algorithm, computed using
+//                    "blAccumulatorType" (double by default)
+//
+//                  - The variance is the population variance
+//                    of the elements currently in the window
+//
+// DATE CREATED:    Oct/18/2026
+//
+// DATE UPDATED:
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,
+         size_t blMaxWindowSize,
+         typename blAccumulatorType = double>
+
+class blSlidingWindow
+{
+public: // Public typedefs
+
+    typedef blCircularIterator<blContainerType>                         blIteratorType;
+    typedef typename blIteratorType::blDataType                         blDataType;
+
+public: // Constructors and destructors
+
+    // Constructor starting
+    // with an empty window
+    // at the container's
+    // begin
+
+    blSlidingWindow(blContainerType& container,
+                    const size_t& windowSize);
+
+    // Constructor starting
+    // with an empty window
+    // at the specified
+    // iterator
+
+    blSlidingWindow(const blIteratorType& startIter,
+                    const size_t& windowSize);
+
+    // Destructor
+
+    ~blSlidingWindow()
+    {
+    }
+
+public: // Overloaded operators
+
+    // Operators used to slide
+    // the window, each slide
+    // brings the next element
+    // in and, once the window
+    // is full, drops its oldest
+    // element
+
+    blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>&     operator++();
+    blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>&     operator+=(const size_t& howManySlides);
+
+public: // Public functions
+
+    // Function used to slide
+    // the window until it is
+    // full
+
+    void                                                                fill();
+
+    // Function used to empty
+    // the window without
+    // moving it
+
+    void                                                                clear();
+
+    // Functions used to get
+    // the window's aggregates
+    //
+    // NOTE:    "min" and "max" can
+    //          only be called when
+    //          the window is not
+    //          empty
+
+    blAccumulatorType                                                   sum()const{return m_sum;}
+    blAccumulatorType                                                   mean()const{return m_mean;}
+    blAccumulatorType                                                   variance()const;
+
+    const blDataType&                                                   min()const{return m_minValues[m_minDequeFront];}
+    const blDataType&                                                   max()const{return m_maxValues[m_maxDequeFront];}
+
+    // Functions used to
+    // query the window
+
+    size_t                                                              size()const{return m_count;}
+    size_t                                                              getWindowSize()const{return m_windowSize;}
+    bool                                                                empty()const{return (m_count == 0);}
+    bool                                                                isFull()const{return (m_count == m_windowSize);}
+
+    // Functions used to get
+    // iterators to the oldest
+    // element in the window
+    // and one past the newest
+
+    const blIteratorType&                                               getOldestIter()const{return m_oldestIter;}
+    const blIteratorType&                                               getNextIter()const{return m_nextIter;}
+
+    // Functions used to get
+    // the window as (at most)
+    // two contiguous segments,
+    // the second one is only
+    // non empty when the window
+    // wraps around the container
+    //
+    // NOTE:    Only available for
+    //          contiguous containers
+
+    blRawArrayWrapper<blDataType>                                       getFirstSegment()const;
+    blRawArrayWrapper<blDataType>                                       getSecondSegment()const;
+
+private: // Private functions
+
+    void                                                                pushNewest(const blDataType& value);
+    void                                                                popOldest();
+
+private: // Private variables
+
+    // The window's
+    // iterators
+
+    blIteratorType                                                      m_oldestIter;
+    blIteratorType                                                      m_nextIter;
+
+    // The window's size
+    // and the number of
+    // elements in it
+
+    size_t                                                              m_windowSize;
+    size_t                                                              m_count;
+
+    // The running
+    // aggregates
+
+    blAccumulatorType                                                   m_sum;
+    blAccumulatorType                                                   m_mean;
+    blAccumulatorType                                                   m_m2;
+
+    // Every element that enters
+    // the window gets a sequence
+    // number, so the deques know
+    // when their front element
+    // leaves the window
+
+    uint64_t                                                            m_nextSequenceNumber;
+
+    // The monotonic deques,
+    // stored as ring buffers
+    // of values and sequence
+    // numbers
+
+    blArray<blDataType,blMaxWindowSize>                                 m_minValues;
+    blArray<uint64_t,blMaxWindowSize>                                   m_minSequenceNumbers;
+    size_t                                                              m_minDequeFront;
+    size_t                                                              m_minDequeSize;
+
+    blArray<blDataType,blMaxWindowSize>                                 m_maxValues;
+    blArray<uint64_t,blMaxWindowSize>                                   m_maxSequenceNumbers;
+    size_t                                                              m_maxDequeFront;
+    size_t                                                              m_maxDequeSize;
+};
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::blSlidingWindow(blContainerType& container,
+                                                                                          const size_t& windowSize)
+                                                                                          : m_oldestIter(container),
+                                                                                            m_nextIter(container)
+{
+    m_windowSize = (windowSize < blMaxWindowSize ? windowSize : blMaxWindowSize);
+
+    clear();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::blSlidingWindow(const blIteratorType& startIter,
+                                                                                          const size_t& windowSize)
+                                                                                          : m_oldestIter(startIter),
+                                                                                            m_nextIter(startIter)
+{
+    m_windowSize = (windowSize < blMaxWindowSize ? windowSize : blMaxWindowSize);
+
+    clear();
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline void blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::clear()
+{
+    m_oldestIter = m_nextIter;
+    m_count = 0;
+
+    m_sum = 0;
+    m_mean = 0;
+    m_m2 = 0;
+
+    m_nextSequenceNumber = 0;
+
+    m_minDequeFront = 0;
+    m_minDequeSize = 0;
+    m_maxDequeFront = 0;
+    m_maxDequeSize = 0;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>& blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::operator++()
+{
+    if(m_windowSize == 0 || m_nextIter.empty())
+        return (*this);
+
+    const blDataType& newValue = (*m_nextIter);
+
+    if(m_count == m_windowSize)
+    {
+        // The oldest element
+        // is replaced by the
+        // new one, which lets
+        // the mean and variance
+        // be updated in one go
+
+        const blDataType& oldValue = (*m_oldestIter);
+
+        blAccumulatorType oldMean = m_mean;
+        blAccumulatorType difference = blAccumulatorType(newValue) - blAccumulatorType(oldValue);
+
+        m_sum += difference;
+        m_mean += difference / blAccumulatorType(m_count);
+        m_m2 += difference * (blAccumulatorType(newValue) - m_mean + blAccumulatorType(oldValue) - oldMean);
+
+        popOldest();
+
+        ++m_oldestIter;
+    }
+    else
+    {
+        ++m_count;
+
+        blAccumulatorType delta = blAccumulatorType(newValue) - m_mean;
+
+        m_sum += blAccumulatorType(newValue);
+        m_mean += delta / blAccumulatorType(m_count);
+        m_m2 += delta * (blAccumulatorType(newValue) - m_mean);
+    }
+
+    pushNewest(newValue);
+
+    ++m_nextIter;
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>& blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::operator+=(const size_t& howManySlides)
+{
+    for(size_t i = 0; i < howManySlides; ++i)
+        ++(*this);
+
+    return (*this);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline void blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::fill()
+{
+    (*this) += (m_windowSize - m_count);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blAccumulatorType blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::variance()const
+{
+    if(m_count == 0)
+        return 0;
+
+    // Rounding can make the
+    // running sum of squares
+    // slightly negative
+
+    if(m_m2 < 0)
+        return 0;
+
+    return m_m2 / blAccumulatorType(m_count);
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline void blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::pushNewest(const blDataType& value)
+{
+    const uint64_t sequenceNumber = m_nextSequenceNumber;
+
+    ++m_nextSequenceNumber;
+
+    // The min deque keeps increasing
+    // values, so every value at its
+    // back not smaller than the new
+    // one can never be the min again
+
+    while(m_minDequeSize > 0 &&
+          !(m_minValues[(m_minDequeFront + m_minDequeSize - 1) % blMaxWindowSize] < value))
+    {
+        --m_minDequeSize;
+    }
+
+    m_minValues[(m_minDequeFront + m_minDequeSize) % blMaxWindowSize] = value;
+    m_minSequenceNumbers[(m_minDequeFront + m_minDequeSize) % blMaxWindowSize] = sequenceNumber;
+    ++m_minDequeSize;
+
+    // Same for the max deque
+    // which keeps decreasing
+    // values
+
+    while(m_maxDequeSize > 0 &&
+          !(value < m_maxValues[(m_maxDequeFront + m_maxDequeSize - 1) % blMaxWindowSize]))
+    {
+        --m_maxDequeSize;
+    }
+
+    m_maxValues[(m_maxDequeFront + m_maxDequeSize) % blMaxWindowSize] = value;
+    m_maxSequenceNumbers[(m_maxDequeFront + m_maxDequeSize) % blMaxWindowSize] = sequenceNumber;
+    ++m_maxDequeSize;
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline void blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::popOldest()
+{
+    // The oldest element in the
+    // window has the sequence number
+    // (next - count), it can only
+    // still be in a deque as its
+    // front element
+
+    const uint64_t oldestSequenceNumber = m_nextSequenceNumber - m_count;
+
+    if(m_minDequeSize > 0 && m_minSequenceNumbers[m_minDequeFront] == oldestSequenceNumber)
+    {
+        m_minDequeFront = (m_minDequeFront + 1) % blMaxWindowSize;
+        --m_minDequeSize;
+    }
+
+    if(m_maxDequeSize > 0 && m_maxSequenceNumbers[m_maxDequeFront] == oldestSequenceNumber)
+    {
+        m_maxDequeFront = (m_maxDequeFront + 1) % blMaxWindowSize;
+        --m_maxDequeSize;
+    }
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blRawArrayWrapper<typename blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::blDataType>
+blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::getFirstSegment()const
+{
+    static_assert(blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value,
+                  "blSlidingWindow segments are only available for contiguous containers");
+
+    if(m_count == 0)
+        return blRawArrayWrapper<blDataType>();
+
+    size_t distanceFromOldestToEnd = static_cast<size_t>(m_oldestIter.getDistanceFromIterToEnd());
+
+    return blRawArrayWrapper<blDataType>(getDataPointer(m_oldestIter.getPtr()),
+                                         (m_count < distanceFromOldestToEnd ? m_count : distanceFromOldestToEnd));
+}
+//-------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------
+template<typename blContainerType,size_t blMaxWindowSize,typename blAccumulatorType>
+inline blRawArrayWrapper<typename blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::blDataType>
+blSlidingWindow<blContainerType,blMaxWindowSize,blAccumulatorType>::getSecondSegment()const
+{
+    static_assert(blIsContiguousRange<blContainerType,typename blIteratorType::iterator>::value,
+                  "blSlidingWindow segments are only available for contiguous containers");
+
+    size_t distanceFromOldestToEnd = static_cast<size_t>(m_oldestIter.getDistanceFromIterToEnd());
+
+    if(m_count <= distanceFromOldestToEnd)
+        return blRawArrayWrapper<blDataType>();
+
+    return blRawArrayWrapper<blDataType>(getDataPointer(m_oldestIter.begin().getPtr()),
+                                         m_count - distanceFromOldestToEnd);
+}
+//-------------------------------------------------------------------
+
+
+#endif // BL_SLIDINGWINDOW_HPP